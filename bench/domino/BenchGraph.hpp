@@ -0,0 +1,55 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: graphs shared by benchmarks, from fixed seed so runs are comparable
+// ***********************************************************************************************
+#pragma once
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Domino.hpp"
+
+namespace RLib
+{
+using EdgeList = std::vector<std::pair<Domino::Event, Domino::Event> >;  // (prev, next)
+
+// ***********************************************************************************************
+enum { N_LAYER = 8 };  // shallow since legacy recursive deduce revisits shared descendants
+
+// each tile has 1~4 true-prev in previous layer; 1st layer has no prev
+inline EdgeList layeredDag(const size_t aNEvent)
+{
+    const size_t width = aNEvent / N_LAYER;
+    std::mt19937 rand(20170104);
+    EdgeList edges;
+    for (Domino::Event next = width; next < aNEvent; ++next)
+    {
+        const auto layerStart = (next / width - 1) * width;
+        std::set<Domino::Event> prevs;  // no dup edge
+        for (size_t nPrev = 1 + rand() % 4; nPrev > 0; --nPrev) prevs.insert(layerStart + rand() % width);
+        for (auto&& prev : prevs) edges.emplace_back(prev, next);
+    }
+    return edges;
+}
+
+// ***********************************************************************************************
+// hierarchical like real usage (eg Yang xpath), so hash/compare cost is realistic
+inline std::string benchEvName(const size_t aEv)
+{
+    return "/o-ran-hw:hardware/component[name=ru-" + std::to_string(aEv) + "]/state/oper-state";
+}
+
+// Domino with aEdges, EvName = benchEvName(event)
+inline void buildDomino(Domino& aDom, const size_t aNEvent, const EdgeList& aEdges)
+{
+    for (Domino::Event ev = 0; ev < aNEvent; ++ev) aDom.newEvent(benchEvName(ev));
+    for (auto&& edge : aEdges) aDom.setPrev(benchEvName(edge.second), {{benchEvName(edge.first), true}});
+}
+}  // namespace
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: Domino::deduceState() (worklist) on shapes that hurt recursion
+//   . deep chain: recursion depth = chain length
+//   . stacked diamonds: recursion revisits 2^nDiamond times
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "Domino.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+void resetAll(Domino& aDom)
+{
+    Domino::SimuEvents allFalse;
+    for (Domino::Event ev = 0; ev < aDom.nEvent(); ++ev) allFalse["e" + std::to_string(ev)] = false;
+    aDom.setState(allFalse);
+}
+
+// ***********************************************************************************************
+void Domino_setState_deepChain(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    Domino dom;
+    for (size_t idx = 0; idx < nEvent; ++idx) dom.newEvent("e" + std::to_string(idx));
+    for (size_t idx = 1; idx < nEvent; ++idx)
+        dom.setPrev("e" + std::to_string(idx), {{"e" + std::to_string(idx - 1), true}});
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        resetAll(dom);
+        aState.ResumeTiming();
+
+        dom.setState({{"e0", true}});
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent);
+}
+BENCHMARK(Domino_setState_deepChain)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+// ***********************************************************************************************
+void Domino_setState_stackedDiamonds(benchmark::State& aState)
+{
+    // e0 -> (e1, e2) -> e3 -> (e4, e5) -> e6 ...
+    const size_t nDiamond = aState.range(0);
+    Domino dom;
+    for (size_t idx = 0; idx <= 3 * nDiamond; ++idx) dom.newEvent("e" + std::to_string(idx));
+    for (size_t top = 0; top < 3 * nDiamond; top += 3)
+    {
+        const auto topName = "e" + std::to_string(top);
+        const auto leftName = "e" + std::to_string(top + 1);
+        const auto rightName = "e" + std::to_string(top + 2);
+        dom.setPrev(leftName, {{topName, true}});
+        dom.setPrev(rightName, {{topName, true}});
+        dom.setPrev("e" + std::to_string(top + 3), {{leftName, true}, {rightName, true}});
+    }
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        resetAll(dom);
+        aState.ResumeTiming();
+
+        dom.setState({{"e0", true}});
+    }
+    aState.SetItemsProcessed(aState.iterations() * dom.nEvent());
+}
+BENCHMARK(Domino_setState_stackedDiamonds)->RangeMultiplier(10)->Range(10, 100'000);
+}  // namespace
@@ -0,0 +1,210 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: main interfaces of Domino family, across the UT combinations (UtInitObjAnywhere.hpp)
+//   . so a regression of any extension (eg PriDomino::effect) shows in its own line
+// - how to track between releases: target bench_json -> bench.json (google-benchmark json)
+// - MsgSelf: loopReq is deferred & drained explicitly (like a real main loop), so setHdlr
+//   bench covers newMsg() + dispatch, not a sync call
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "UtInitObjAnywhere.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct BenchEnv  // ObjAnywhere + deferred MsgSelf, per benchmark run
+{
+    BenchEnv()
+    {
+        ObjAnywhere::init();
+        ObjAnywhere::set<MsgSelf>(std::make_shared<MsgSelf>([this](LoopBackFUNC aFunc){ loops_.push_back(aFunc); }));
+    }
+    ~BenchEnv() { ObjAnywhere::deinit(); }
+
+    void drain()  // = main loop: run all hdlrs
+    {
+        while (not loops_.empty())
+        {
+            auto loops = std::move(loops_);
+            loops_.clear();
+            for (auto&& loop : loops) loop();
+        }
+    }
+
+    std::vector<LoopBackFUNC> loops_;
+};
+
+inline std::string evName(const size_t aIdx) { return "/a/b[" + std::to_string(aIdx) + "]/c"; }
+
+// ***********************************************************************************************
+template<class aDom>
+void newEvent(benchmark::State& aState)
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    std::vector<std::string> names;
+    for (size_t idx = 0; idx < nEvent; ++idx) names.push_back(evName(idx));
+
+    for (auto _ : aState)
+    {
+        aDom dom;
+        for (auto&& name : names) benchmark::DoNotOptimize(dom.newEvent(name));
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent);
+}
+
+// ***********************************************************************************************
+template<class aDom>
+void setPrev_chain(benchmark::State& aState)
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    std::vector<std::string> names;
+    for (size_t idx = 0; idx < nEvent; ++idx) names.push_back(evName(idx));
+
+    for (auto _ : aState)
+    {
+        aDom dom;
+        for (size_t idx = 1; idx < nEvent; ++idx) dom.setPrev(names[idx], {{names[idx - 1], true}});
+    }
+    aState.SetItemsProcessed(aState.iterations() * (nEvent - 1));
+}
+
+// ***********************************************************************************************
+// aShape: 0 = chain (e0->e1->...), 1 = fan-out (e0->all), 2 = fan-in (all->e0)
+template<class aDom, int aShape>
+void setState(benchmark::State& aState)
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    aDom dom;
+    Domino::SimuEvents trigger;  // make all true
+    Domino::SimuEvents reset;    // make all false
+    for (size_t idx = 1; idx < nEvent; ++idx)
+    {
+        if (aShape == 0) dom.setPrev(evName(idx), {{evName(idx - 1), true}});
+        else if (aShape == 1) dom.setPrev(evName(idx), {{evName(0), true}});
+        else dom.setPrev(evName(0), {{evName(idx), true}});
+
+        if (aShape == 2) trigger[evName(idx)] = true;
+    }
+    if (aShape != 2) trigger[evName(0)] = true;
+    for (size_t idx = 0; idx < nEvent; ++idx) reset[evName(idx)] = false;
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        dom.setState(reset);
+        aState.ResumeTiming();
+
+        dom.setState(trigger);
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent);
+}
+
+// ***********************************************************************************************
+template<class aDom>
+void whyFalse_fanIn(benchmark::State& aState)  // worst: only last prev unsatisfied
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    aDom dom;
+    Domino::SimuEvents prevs;
+    for (size_t idx = 1; idx < nEvent; ++idx)
+    {
+        dom.setPrev(evName(0), {{evName(idx), true}});
+        if (idx + 1 < nEvent) prevs[evName(idx)] = true;
+    }
+    dom.setState(prevs);
+    const auto target = evName(0);
+
+    for (auto _ : aState) benchmark::DoNotOptimize(dom.whyFalse(target));
+    aState.SetItemsProcessed(aState.iterations());
+}
+
+// ***********************************************************************************************
+// FreeHdlrDomino frees hdlr after 1st call, so flag repeated to dispatch every iteration
+template<class aDom>
+auto flagRepeat(aDom& aDomino, const std::string& aEvName, int) -> decltype(aDomino.flagRepeatedHdlr(aEvName), void())
+{
+    aDomino.flagRepeatedHdlr(aEvName);
+}
+template<class aDom>
+void flagRepeat(aDom&, const std::string&, long) {}
+
+template<class aDom>
+void setHdlr_dispatch(benchmark::State& aState)  // fan-out, each next has 1 hdlr
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    aDom dom;
+    size_t nCalled = 0;
+    Domino::SimuEvents reset;  // F won't cascade, so reset each
+    for (size_t idx = 1; idx < nEvent; ++idx)
+    {
+        dom.setPrev(evName(idx), {{evName(0), true}});
+        dom.setHdlr(evName(idx), [&nCalled](){ ++nCalled; });
+        flagRepeat(dom, evName(idx), 0);
+    }
+    for (size_t idx = 0; idx < nEvent; ++idx) reset[evName(idx)] = false;
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        dom.setState(reset);
+        aState.ResumeTiming();
+
+        dom.setState({{evName(0), true}});
+        env.drain();
+    }
+    aState.SetItemsProcessed(nCalled);
+}
+
+// ***********************************************************************************************
+template<class aDom>
+void setValue_getValue(benchmark::State& aState)
+{
+    BenchEnv env;
+    const size_t nEvent = aState.range(0);
+    aDom dom;
+    std::vector<std::string> names;
+    for (size_t idx = 0; idx < nEvent; ++idx) names.push_back(evName(idx));
+
+    for (auto _ : aState)
+    {
+        for (size_t idx = 0; idx < nEvent; ++idx) setValue<aDom, size_t>(dom, names[idx], idx);
+        for (auto&& name : names) benchmark::DoNotOptimize(getValue<aDom, size_t>(dom, name));
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent * 2);
+}
+
+// ***********************************************************************************************
+#define BENCH_ALL_DOM(aBench, ...) \
+    BENCHMARK_TEMPLATE(aBench, MinDatDom, ##__VA_ARGS__)->RangeMultiplier(10)->Range(100, 10'000); \
+    BENCHMARK_TEMPLATE(aBench, MinHdlrDom, ##__VA_ARGS__)->RangeMultiplier(10)->Range(100, 10'000); \
+    BENCHMARK_TEMPLATE(aBench, MinMhdlrDom, ##__VA_ARGS__)->RangeMultiplier(10)->Range(100, 10'000); \
+    BENCHMARK_TEMPLATE(aBench, MinPriDom, ##__VA_ARGS__)->RangeMultiplier(10)->Range(100, 10'000); \
+    BENCHMARK_TEMPLATE(aBench, MaxDom, ##__VA_ARGS__)->RangeMultiplier(10)->Range(100, 10'000)
+
+BENCH_ALL_DOM(newEvent);
+BENCH_ALL_DOM(setPrev_chain);
+BENCH_ALL_DOM(setState, 0);
+BENCH_ALL_DOM(setState, 1);
+BENCH_ALL_DOM(setState, 2);
+BENCH_ALL_DOM(whyFalse_fanIn);
+
+// only Dominos w/ the interface
+BENCHMARK_TEMPLATE(setHdlr_dispatch, MinHdlrDom)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(setHdlr_dispatch, MinMhdlrDom)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(setHdlr_dispatch, MinPriDom)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(setHdlr_dispatch, MaxDom)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(setValue_getValue, MinDatDom)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK_TEMPLATE(setValue_getValue, MaxDom)->RangeMultiplier(10)->Range(100, 10'000);
+}  // namespace
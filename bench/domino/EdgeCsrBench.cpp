@@ -0,0 +1,167 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: EdgeCsr vs legacy map<Event, set<Event>> (Domino's prev_/next_ before EdgeCsr)
+//   . propagation time: same deduce algo as Domino, only adjacency differs
+//   . bytesPerEdge: prev + next mem / nEdge
+// - graph: layered DAG from fixed seed, each tile has 1~4 true-prev in previous layer
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchGraph.hpp"
+#include "EdgeCsr.hpp"
+
+namespace RLib
+{
+using Event = Domino::Event;
+
+// ***********************************************************************************************
+size_t nLegacyBytes = 0;
+
+template<class aType>
+struct CountAlloc
+{
+    using value_type = aType;
+    CountAlloc() = default;
+    template<class aOther> CountAlloc(const CountAlloc<aOther>&) {}
+
+    aType* allocate(const size_t aN)
+    {
+        nLegacyBytes += aN * sizeof(aType);
+        return std::allocator<aType>().allocate(aN);
+    }
+    void deallocate(aType* aPtr, const size_t aN)
+    {
+        nLegacyBytes -= aN * sizeof(aType);
+        std::allocator<aType>().deallocate(aPtr, aN);
+    }
+    template<class aOther> bool operator==(const CountAlloc<aOther>&) const { return true; }
+    template<class aOther> bool operator!=(const CountAlloc<aOther>&) const { return false; }
+};
+
+// ***********************************************************************************************
+struct LegacyAdj
+{
+    using Events = std::set<Event, std::less<Event>, CountAlloc<Event> >;
+    using Adj = std::map<Event, Events, std::less<Event>, CountAlloc<std::pair<const Event, Events> > >;
+
+    explicit LegacyAdj(const EdgeList& aEdges)
+    {
+        const auto nBytesBefore = nLegacyBytes;
+        for (auto&& edge : aEdges)
+        {
+            prev_[true][edge.second].insert(edge.first);
+            next_[true][edge.first].insert(edge.second);
+        }
+        nBytes_ = nLegacyBytes - nBytesBefore;
+    }
+    size_t nBytes() const { return nBytes_; }
+    void deduce(const Event aEv)
+    {
+        for (auto&& prevEv : prev_[true][aEv]) if (states_[prevEv] != true) return;
+        for (auto&& prevEv : prev_[false][aEv]) if (states_[prevEv] != false) return;
+        states_[aEv] = true;
+        for (auto&& nextEv : next_[true][aEv]) deduce(nextEv);
+    }
+
+    Adj prev_[Domino::N_EVENT_STATE];
+    Adj next_[Domino::N_EVENT_STATE];
+    std::vector<bool> states_;
+    size_t nBytes_ = 0;
+};
+
+// ***********************************************************************************************
+struct CsrAdj
+{
+    explicit CsrAdj(const EdgeList& aEdges)
+    {
+        for (auto&& edge : aEdges)
+        {
+            prev_.add(edge.second, EdgeCsr::toEdge(edge.first, true));
+            next_.add(edge.first, EdgeCsr::toEdge(edge.second, true));
+        }
+        prev_.compact();
+        next_.compact();
+    }
+    size_t nBytes() const { return prev_.nBytes() + next_.nBytes(); }
+    void deduce(const Event aEv)
+    {
+        for (size_t idx = 0, nPrev = prev_.degree(aEv); idx < nPrev; ++idx)
+        {
+            auto&& prevEdge = prev_.at(aEv, idx);
+            if (states_[EdgeCsr::nodeOf(prevEdge)] != EdgeCsr::flagOf(prevEdge)) return;
+        }
+        states_[aEv] = true;
+        for (size_t idx = 0, nNext = next_.degree(aEv); idx < nNext; ++idx)
+        {
+            auto&& nextEdge = next_.at(aEv, idx);
+            if (EdgeCsr::flagOf(nextEdge)) deduce(EdgeCsr::nodeOf(nextEdge));
+        }
+    }
+
+    EdgeCsr prev_;
+    EdgeCsr next_;
+    std::vector<bool> states_;
+};
+
+// ***********************************************************************************************
+template<class aAdj>
+void propagate(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    const auto edges = layeredDag(nEvent);
+    aAdj adj(edges);
+
+    for (auto _ : aState)
+    {
+        adj.states_.assign(nEvent, false);
+        for (Event ev = 0; ev < nEvent / N_LAYER; ++ev) adj.deduce(ev);  // 1st layer has no prev
+        benchmark::DoNotOptimize(adj.states_);
+    }
+    aState.SetItemsProcessed(aState.iterations() * edges.size());
+    aState.counters["nEdge"] = edges.size();
+    aState.counters["bytesPerEdge"] = double(adj.nBytes()) / edges.size();
+}
+BENCHMARK_TEMPLATE(propagate, LegacyAdj)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(propagate, CsrAdj)->RangeMultiplier(10)->Range(1'000, 100'000);
+
+// ***********************************************************************************************
+// real Domino: setState() the 1st layer, broadcast to all
+// - aFreeze=false: built by setPrev() only (no manual compact), as most users; vs frozen
+template<bool aFreeze>
+void Domino_setState_layeredDag(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    const auto edges = layeredDag(nEvent);
+    Domino dom;
+    for (Event ev = 0; ev < nEvent; ++ev) dom.newEvent(std::to_string(ev));
+    for (auto&& edge : edges) dom.setPrev(std::to_string(edge.second), {{std::to_string(edge.first), true}});
+    if (aFreeze) dom.freeze();
+
+    Domino::SimuEvents firstLayer;
+    Domino::SimuEvents allFalse;
+    for (Event ev = 0; ev < nEvent; ++ev) allFalse[std::to_string(ev)] = false;
+    for (Event ev = 0; ev < nEvent / N_LAYER; ++ev) firstLayer[std::to_string(ev)] = true;
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        dom.setState(allFalse);
+        aState.ResumeTiming();
+
+        dom.setState(firstLayer);
+    }
+    aState.SetItemsProcessed(aState.iterations() * edges.size());
+}
+BENCHMARK_TEMPLATE(Domino_setState_layeredDag, false)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(Domino_setState_layeredDag, true)->RangeMultiplier(10)->Range(1'000, 100'000);
+}  // namespace
@@ -0,0 +1,120 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: steady state (graph fixed, only state changes) before vs after Domino::freeze()
+//   . arg 0 = nEvent, arg 1 = frozen or not
+//   . lookup: getEventBy() of all EvNames, runtime str & literal-like precomputed hash
+//   . setState: broadcast 1st layer of layered DAG to all
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "BenchGraph.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+void Domino_getEventBy(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    Domino dom;
+    buildDomino(dom, nEvent, EdgeList());
+    if (aState.range(1)) dom.freeze();
+
+    std::vector<std::string> names;
+    for (Domino::Event ev = 0; ev < nEvent; ++ev) names.push_back(benchEvName(ev));
+
+    for (auto _ : aState)
+    {
+        for (auto&& name : names) benchmark::DoNotOptimize(dom.getEventBy(name));
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent);
+    auto&& mem = dom.memFootprint();
+    aState.counters["nameBytesPerEv"] = double(mem.evNames_) / nEvent;
+    aState.counters["indexBytesPerEv"] = double(mem.evIndex_) / nEvent;
+}
+BENCHMARK(Domino_getEventBy)->ArgNames({"nEvent", "frozen"})
+    ->ArgsProduct({{1'000, 100'000}, {false, true}});
+
+// ***********************************************************************************************
+void Domino_getEventBy_hashed(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    Domino dom;
+    buildDomino(dom, nEvent, EdgeList());
+    if (aState.range(1)) dom.freeze();
+
+    std::vector<std::string> names;
+    for (Domino::Event ev = 0; ev < nEvent; ++ev) names.push_back(benchEvName(ev));
+    std::vector<HashedEvName> hashed;  // = "..."_ev, hash not in loop
+    for (auto&& name : names) hashed.emplace_back(name);
+
+    for (auto _ : aState)
+    {
+        for (auto&& name : hashed) benchmark::DoNotOptimize(dom.getEventBy(name));
+    }
+    aState.SetItemsProcessed(aState.iterations() * nEvent);
+}
+BENCHMARK(Domino_getEventBy_hashed)->ArgNames({"nEvent", "frozen"})
+    ->ArgsProduct({{1'000, 100'000}, {false, true}});
+
+// ***********************************************************************************************
+void Domino_setState_frozen(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    const auto edges = layeredDag(nEvent);
+    Domino dom;
+    buildDomino(dom, nEvent, edges);
+    if (aState.range(1)) dom.freeze();
+
+    std::vector<Domino::EventHandle> firstLayer;
+    std::vector<Domino::EventHandle> all;
+    for (Domino::Event ev = 0; ev < nEvent; ++ev) all.push_back(dom.newHandle(benchEvName(ev)));
+    for (Domino::Event ev = 0; ev < nEvent / N_LAYER; ++ev) firstLayer.push_back(all[ev]);
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        for (auto&& hdl : all) dom.setState(hdl, false);
+        aState.ResumeTiming();
+
+        for (auto&& hdl : firstLayer) dom.setState(hdl, true);
+    }
+    aState.SetItemsProcessed(aState.iterations() * edges.size());
+}
+BENCHMARK(Domino_setState_frozen)->ArgNames({"nEvent", "frozen"})
+    ->ArgsProduct({{1'000, 100'000}, {false, true}});
+
+// ***********************************************************************************************
+// instance from template: build own topology vs shareTopo(); bytesPerInst = resident mem per instance
+void Domino_newInstance(benchmark::State& aState)
+{
+    const size_t nEvent = aState.range(0);
+    const bool share = aState.range(1);
+    const auto edges = layeredDag(nEvent);
+    Domino tmpl;
+    buildDomino(tmpl, nEvent, edges);
+    tmpl.freeze();
+
+    size_t bytesPerInst = 0;
+    for (auto _ : aState)
+    {
+        Domino inst;
+        if (share) inst.shareTopo(tmpl);
+        else
+        {
+            buildDomino(inst, nEvent, edges);
+            inst.freeze();
+        }
+        auto&& mem = inst.memFootprint();
+        bytesPerInst = share ? mem.perEvent_ : mem.total();
+    }
+    aState.counters["bytesPerInst"] = bytesPerInst;
+}
+BENCHMARK(Domino_newInstance)->ArgNames({"nEvent", "share"})
+    ->ArgsProduct({{1'000, 100'000}, {false, true}})->Unit(benchmark::kMicrosecond);
+}  // namespace
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: 1 setState() batch over 64 disjoint components (eg per-cell pipelines), serial vs
+//   setParallel(); arg = nEvent per component
+// - Domino_batch: small chains, arg = nCand per batch; where 4thread overtakes serial = default minCand
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <memory>  // unique_ptr
+#include <string>
+
+#include "Domino.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+void Domino_comps(benchmark::State& aState, const size_t aNThread)
+{
+    const size_t nComp = 64;
+    const size_t nEvPerComp = aState.range(0);
+    Domino tmpl;
+    Domino::SimuEvents roots;
+    for (size_t comp = 0; comp < nComp; ++comp)
+    {
+        const auto prefix = "/cell[" + std::to_string(comp) + "]/step";
+        for (size_t idx = 1; idx < nEvPerComp; ++idx)
+            tmpl.setPrev(prefix + std::to_string(idx), {{prefix + std::to_string((idx - 1) / 2), true}});
+        roots[prefix + "0"] = true;
+    }
+    tmpl.freeze();
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        auto dom = std::make_unique<Domino>();  // all false again
+        dom->shareTopo(tmpl);
+        dom->setParallel(aNThread, 1);
+        aState.ResumeTiming();
+
+        dom->setState(roots);
+
+        aState.PauseTiming();
+        dom.reset();
+        aState.ResumeTiming();
+    }
+    aState.SetItemsProcessed(aState.iterations() * nComp * nEvPerComp);
+}
+BENCHMARK_CAPTURE(Domino_comps, serial, 1)->RangeMultiplier(10)->Range(100, 10'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Domino_comps, 4thread, 4)->RangeMultiplier(10)->Range(100, 10'000)->Unit(benchmark::kMillisecond);
+
+// ***********************************************************************************************
+void Domino_batch(benchmark::State& aState, const size_t aNThread)
+{
+    const size_t nCand = aState.range(0);
+    const size_t nEvPerComp = 8;
+    Domino dom;
+    Domino::SimuEvents roots;
+    Domino::SimuEvents allFalse;
+    for (size_t comp = 0; comp < nCand; ++comp)
+    {
+        const auto prefix = "/cell[" + std::to_string(comp) + "]/step";
+        for (size_t idx = 1; idx < nEvPerComp; ++idx)
+            dom.setPrev(prefix + std::to_string(idx), {{prefix + std::to_string(idx - 1), true}});
+        roots[prefix + "0"] = true;
+        allFalse[prefix + "0"] = false;
+    }
+    dom.setParallel(aNThread, 1);
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        dom.setRetract(true);  // so allFalse resets the chains (parallel not applied then)
+        dom.setState(allFalse);
+        dom.setRetract(false);
+        aState.ResumeTiming();
+
+        dom.setState(roots);
+    }
+    aState.SetItemsProcessed(aState.iterations() * nCand * nEvPerComp);
+}
+BENCHMARK_CAPTURE(Domino_batch, serial, 1)->RangeMultiplier(2)->Range(8, 1024);
+BENCHMARK_CAPTURE(Domino_batch, 4thread, 4)->RangeMultiplier(2)->Range(8, 1024);
+}  // namespace
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: replay 1 workload on N instances: N Dominos vs 1 SlicedDomino
+// - args: {nInst}
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+#include <memory>
+
+#include "DominoWorkload.hpp"
+#include "SlicedDomino.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+DominoWorkload slicedBenchWorkload()
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = 10'000;
+    return genWorkload(cfg);
+}
+
+// ***********************************************************************************************
+void NDomino_replay(benchmark::State& aState)
+{
+    const size_t nInst = aState.range(0);
+    const auto wl = slicedBenchWorkload();
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        std::vector<std::unique_ptr<Domino> > doms;
+        for (size_t inst = 0; inst < nInst; ++inst)
+        {
+            doms.emplace_back(new Domino);
+            loadWorkload(*doms.back(), wl);
+        }
+        aState.ResumeTiming();
+
+        for (auto&& dom : doms) replayWorkload(*dom, wl);
+    }
+    aState.SetItemsProcessed(aState.iterations() * nInst * wl.stimuli.size());
+}
+
+// ***********************************************************************************************
+void SlicedDomino_replay(benchmark::State& aState)  // all inst get same stimulus, 1 pass each
+{
+    const size_t nInst = aState.range(0);
+    const auto wl = slicedBenchWorkload();
+    Domino topo;
+    loadWorkload(topo, wl);
+
+    std::vector<std::string> evNames;
+    for (auto&& stimulus : wl.stimuli) evNames.push_back(DominoWorkload::evName(stimulus.event));
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        SlicedDomino sliced(topo, nInst);
+        const auto all = sliced.allInsts();
+        aState.ResumeTiming();
+
+        for (size_t idx = 0; idx < wl.stimuli.size(); ++idx)
+            sliced.setState(all, {{evNames[idx], wl.stimuli[idx].state}});
+    }
+    aState.SetItemsProcessed(aState.iterations() * nInst * wl.stimuli.size());
+}
+
+BENCHMARK(NDomino_replay)->RangeMultiplier(8)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(SlicedDomino_replay)->RangeMultiplier(8)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+}  // namespace
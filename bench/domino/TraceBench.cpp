@@ -0,0 +1,72 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: TraceRing's cost on the setState() stream (off vs on), & DominoReplay of a recorded trace
+// - args: {nEvent}, RANDOM_DAG w/ 10% false edges (like WorkloadBench)
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+
+#include "DominoReplay.hpp"
+#include "DominoWorkload.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+DominoWorkload traceWorkload(const benchmark::State& aState)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = aState.range(0);
+    cfg.falsePct = 10;
+    return genWorkload(cfg);
+}
+
+// ***********************************************************************************************
+void Trace_replayWorkload(benchmark::State& aState)  // arg1: trace on?
+{
+    const auto wl = traceWorkload(aState);
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        Domino dom;
+        loadWorkload(dom, wl);
+        if (aState.range(1)) TraceRing::start(1u << 20);
+        aState.ResumeTiming();
+
+        replayWorkload(dom, wl);
+    }
+    TraceRing::stop();
+    aState.SetItemsProcessed(aState.iterations() * wl.stimuli.size());
+}
+
+// ***********************************************************************************************
+void Trace_replayTrace(benchmark::State& aState)  // = Trace_replayWorkload's stream, from trace
+{
+    const auto wl = traceWorkload(aState);
+    Domino recorded;
+    loadWorkload(recorded, wl);
+    Domino start = recorded;  // same states as recorded before trace
+    TraceRing::start(1u << 20);
+    replayWorkload(recorded, wl);
+    TraceRing::stop();
+    const auto records = TraceRing::collect();
+
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        Domino dom = start;
+        DominoReplay replay(dom, records, DominoReplay::srcOf(recorded));
+        aState.ResumeTiming();
+
+        benchmark::DoNotOptimize(replay.run());
+    }
+    aState.counters["records"] = records.size();
+    aState.SetItemsProcessed(aState.iterations() * wl.stimuli.size());
+}
+
+// ***********************************************************************************************
+BENCHMARK(Trace_replayWorkload)->ArgsProduct({{1'000, 100'000}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(Trace_replayTrace)->Arg(1'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+}  // namespace
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: what-if of 1 step on a big frozen base: overlay vs copy the whole Domino then setState()
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+
+#include "DominoWorkload.hpp"
+#include "WhatIf.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct WhatIfEnv
+{
+    explicit WhatIfEnv(const size_t aNEvent)
+    {
+        WorkloadCfg cfg;
+        cfg.nEvent = aNEvent;
+        wl_ = genWorkload(cfg);
+        loadWorkload(base_, wl_);
+        base_.freeze();
+        stimulus_ = DominoWorkload::evName(wl_.stimuli.front().event);
+    }
+
+    DominoWorkload wl_;
+    Domino base_;
+    Domino::EvName stimulus_;
+};
+
+// ***********************************************************************************************
+void WhatIf_overlay(benchmark::State& aState)
+{
+    WhatIfEnv env(aState.range(0));
+    size_t nFired = 0;
+    for (auto _ : aState)
+    {
+        WhatIf whatIf(env.base_);
+        whatIf.setState({{env.stimulus_, true}});
+        nFired = whatIf.fired().size();
+        benchmark::DoNotOptimize(nFired);
+    }
+    aState.counters["fired"] = nFired;
+}
+
+// ***********************************************************************************************
+void WhatIf_copyDomino(benchmark::State& aState)
+{
+    WhatIfEnv env(aState.range(0));
+    for (auto _ : aState)
+    {
+        Domino copy;
+        copy.shareTopo(env.base_);  // cheapest full copy: states only
+        copy.setState({{env.stimulus_, true}});
+        benchmark::DoNotOptimize(copy.state(env.stimulus_));
+    }
+}
+BENCHMARK(WhatIf_overlay)->RangeMultiplier(10)->Range(1'000, 100'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(WhatIf_copyDomino)->RangeMultiplier(10)->Range(1'000, 100'000)->Unit(benchmark::kMicrosecond);
+}  // namespace
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: load & replay synthetic workloads (DominoWorkload.hpp) at scale
+// - args: {nEvent, shape}; 10^7 is supported by the generator but takes minutes & GBs, so
+//   not registered by default (eg add ->Args({10'000'000, ...}) for capacity planning)
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+
+#include "DominoWorkload.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+WorkloadCfg benchCfg(const benchmark::State& aState)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = aState.range(0);
+    cfg.shape = WorkloadCfg::Shape(aState.range(1));
+    cfg.falsePct = 10;
+    return cfg;
+}
+
+// ***********************************************************************************************
+void Workload_load(benchmark::State& aState)  // newEvent() + setPrev()
+{
+    const auto wl = genWorkload(benchCfg(aState));
+    for (auto _ : aState)
+    {
+        Domino dom;
+        loadWorkload(dom, wl);
+        benchmark::DoNotOptimize(dom.nEvent());
+    }
+    aState.counters["edges"] = wl.edges.size();
+    aState.SetItemsProcessed(aState.iterations() * wl.edges.size());
+}
+
+// ***********************************************************************************************
+void Workload_loadGraph(benchmark::State& aState)  // 1 loadGraph(), same graph as Workload_load
+{
+    const auto wl = genWorkload(benchCfg(aState));
+    for (auto _ : aState)
+    {
+        Domino dom;
+        loadWorkloadGraph(dom, wl);
+        benchmark::DoNotOptimize(dom.nEvent());
+    }
+    aState.counters["edges"] = wl.edges.size();
+    aState.SetItemsProcessed(aState.iterations() * wl.edges.size());
+}
+
+// ***********************************************************************************************
+void Workload_replay(benchmark::State& aState)  // setState() stream
+{
+    const auto wl = genWorkload(benchCfg(aState));
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        Domino dom;
+        loadWorkload(dom, wl);
+        aState.ResumeTiming();
+
+        replayWorkload(dom, wl);
+    }
+    aState.counters["steps"] = wl.nStep();
+    aState.SetItemsProcessed(aState.iterations() * wl.stimuli.size());
+}
+
+// ***********************************************************************************************
+void Workload_replayRetract(benchmark::State& aState)  // same stream, falsePct inputs cascade T->F
+{
+    const auto wl = genWorkload(benchCfg(aState));
+    for (auto _ : aState)
+    {
+        aState.PauseTiming();
+        Domino dom;
+        loadWorkload(dom, wl);
+        dom.setRetract(true);
+        aState.ResumeTiming();
+
+        replayWorkload(dom, wl);
+    }
+    aState.counters["steps"] = wl.nStep();
+    aState.SetItemsProcessed(aState.iterations() * wl.stimuli.size());
+}
+
+// ***********************************************************************************************
+void workloadArgs(benchmark::internal::Benchmark* aBench)
+{
+    for (auto shape : {WorkloadCfg::RANDOM_DAG, WorkloadCfg::PHASED_PIPELINE, WorkloadCfg::FAN_IN_BARRIER})
+        for (int64_t nEvent = 1'000; nEvent <= 1'000'000; nEvent *= 10) aBench->Args({nEvent, shape});
+}
+BENCHMARK(Workload_load)->Apply(workloadArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(Workload_loadGraph)->Apply(workloadArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(Workload_replay)->Apply(workloadArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(Workload_replayRetract)->Apply(workloadArgs)->Unit(benchmark::kMillisecond);
+}  // namespace
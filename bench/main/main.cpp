@@ -0,0 +1,11 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - how: ./bench.exe [--benchmark_filter=<regex>] [--benchmark_format=json]
+// ***********************************************************************************************
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
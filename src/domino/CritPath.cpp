@@ -0,0 +1,220 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>  // nth_element, sort
+#include <iomanip>    // setprecision
+#include <sstream>
+#include <unordered_map>
+
+#include "CritPath.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aEvent>
+BasicCritPath<aEvent>::BasicCritPath(const BasicDomino<aEvent>& aDom, const TraceRing::Records& aRecords,
+    const uint32_t aSrc)
+    : dom_(aDom)
+    , timings_(aDom.nEvent())
+    , cause_(aDom.nEvent(), BasicDomino<aEvent>::D_EVENT_FAILED_RET)
+{
+    std::unordered_map<uint16_t, std::vector<Event> > running;  // [thread]=hdlrs in run (nested if sync)
+    for (auto&& rec : aRecords)
+    {
+        if (rec.src_ != aSrc || rec.id_ >= timings_.size()) continue;
+        const auto ev = Event(rec.id_);
+        auto&& timing = timings_[ev];
+        switch (rec.kind_)
+        {
+        case TraceRing::STATE_TRUE:
+            timing.true_ = rec.tsc_;
+            break;
+        case TraceRing::TRIGGER_HDLR:
+            timing.hdlrQueued_ = rec.tsc_;
+            break;
+        case TraceRing::HDLR_BEGIN:
+            timing.hdlrBegin_ = rec.tsc_;
+            running[rec.thread_].push_back(ev);
+            break;
+        case TraceRing::HDLR_END:
+            timing.hdlrEnd_ = rec.tsc_;
+            if (not running[rec.thread_].empty()) running[rec.thread_].pop_back();
+            break;
+        case TraceRing::SET_TRUE:
+        {
+            auto&& hdlrs = running[rec.thread_];
+            cause_[ev] = hdlrs.empty() ? BasicDomino<aEvent>::D_EVENT_FAILED_RET : hdlrs.back();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    std::vector<Event> preds;
+    for (Event ev = 0; ev < timings_.size(); ++ev)
+    {
+        predsOf(ev, preds);
+        if (preds.empty()) continue;  // input, or not true in trace
+
+        const size_t need = dom_.topo_->need_[ev];
+        const auto nth = need == 0 || need > preds.size() ? preds.size() - 1 : need - 1;  // k-of-n: k-th
+        std::nth_element(preds.begin(), preds.begin() + nth, preds.end(),
+            [this](const Event aLeft, const Event aRight) { return timings_[aLeft].true_ < timings_[aRight].true_; });
+        timings_[ev].gate_ = preds[nth];
+    }
+}
+
+// ***********************************************************************************************
+// slack by latest allowed time, backward from target: latest(pred) = latest(ev) - own time of ev
+template<class aEvent>
+bool BasicCritPath<aEvent>::analyze(const EvNameView aTarget)
+{
+    auto target = aTarget.empty() ? BasicDomino<aEvent>::D_EVENT_FAILED_RET : dom_.getEventBy(aTarget);
+    if (aTarget.empty() && not timings_.empty())
+        target = Event(std::max_element(timings_.begin(), timings_.end(),
+            [](const Timing& aLeft, const Timing& aRight) { return aLeft.true_ < aRight.true_; }) - timings_.begin());
+    path_.clear();
+    for (auto&& timing : timings_) timing.slack_ = NO_SLACK;
+    if (target >= timings_.size() || timings_[target].true_ == 0) return false;
+
+    for (auto ev = target; ev != BasicDomino<aEvent>::D_EVENT_FAILED_RET && path_.size() < timings_.size();
+        ev = timings_[ev].gate_)
+        path_.push_back(ev);  // gate is satisfied before (size check only for same TSC)
+    std::reverse(path_.begin(), path_.end());
+
+    // target's ancestors, each after all its nexts (reverse post-order of iterative DFS)
+    struct Frame
+    {
+        Event ev_;
+        std::vector<Event> preds_;
+        size_t next_ = 0;
+    };
+    std::vector<Frame> stack(1, Frame{target, {}});
+    predsOf(target, stack.back().preds_);
+    std::vector<bool> visited(timings_.size());
+    visited[target] = true;
+    std::vector<Event> order;
+    while (not stack.empty())
+    {
+        if (stack.back().next_ < stack.back().preds_.size())
+        {
+            const auto pred = stack.back().preds_[stack.back().next_++];
+            if (visited[pred]) continue;
+            visited[pred] = true;
+            stack.push_back(Frame{pred, {}});
+            predsOf(pred, stack.back().preds_);
+            continue;
+        }
+        order.push_back(stack.back().ev_);
+        stack.pop_back();
+    }
+
+    std::vector<uint64_t> latest(timings_.size(), NO_SLACK);
+    latest[target] = timings_[target].true_;
+    std::vector<Event> preds;
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        auto&& timing = timings_[*it];
+        if (latest[*it] == NO_SLACK) continue;  // eg k-of-n's prev not needed
+        timing.slack_ = latest[*it] - timing.true_;
+        if (timing.gate_ == BasicDomino<aEvent>::D_EVENT_FAILED_RET) continue;
+
+        const auto gateTime = timings_[timing.gate_].true_;
+        const auto bound = latest[*it] - (timing.true_ - gateTime);
+        predsOf(*it, preds);
+        for (auto&& pred : preds)
+            if (timings_[pred].true_ <= gateTime) latest[pred] = std::min(latest[pred], bound);  // k-of-n: needed only
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicCritPath<aEvent>::EvNameViews BasicCritPath<aEvent>::path() const
+{
+    EvNameViews path;
+    for (auto&& ev : path_) path.push_back(dom_.evName(ev));
+    return path;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicCritPath<aEvent>::predsOf(const Event aEv, std::vector<Event>& aPreds) const
+{
+    aPreds.clear();
+    const auto time = timings_[aEv].true_;
+    if (time == 0) return;
+
+    auto&& prev = dom_.topo_->prev_;
+    for (size_t idx = 0, nPrev = prev.degree(aEv); idx < nPrev; ++idx)
+    {
+        auto&& prevEdge = prev.at(aEv, idx);
+        const auto prevEv = BasicDomino<aEvent>::EdgeCsr::nodeOf(prevEdge);
+        const auto prevTime = timings_[prevEv].true_;
+        if (BasicDomino<aEvent>::EdgeCsr::flagOf(prevEdge) && prevTime && prevTime <= time) aPreds.push_back(prevEv);
+    }
+    const auto cause = cause_[aEv];
+    if (cause != BasicDomino<aEvent>::D_EVENT_FAILED_RET && timings_[cause].true_ && timings_[cause].true_ <= time)
+        aPreds.push_back(cause);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+std::string BasicCritPath<aEvent>::report(const size_t aTopN) const
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (path_.empty()) return "no critical path (analyze() 1st, & target shall become true in trace)\n";
+
+    const auto begin = timings_[path_.front()].true_;
+    out << "critical path: " << path_.size() << " tiles, " << toUs(timings_[path_.back()].true_ - begin) << "us\n";
+    auto prevTime = begin;
+    for (auto&& ev : path_)
+    {
+        auto&& timing = timings_[ev];
+        out << "  +" << toUs(timing.true_ - prevTime) << "us\t" << dom_.evName(ev);
+        if (timing.gate_ != BasicDomino<aEvent>::D_EVENT_FAILED_RET && timing.gate_ == cause_[ev])
+            out << "\t(set by hdlr of prev step)";
+        if (timing.hdlrQueued_)
+            out << "\thdlr queue=" << toUs(timing.queueDelay()) << "us run=" << toUs(timing.hdlrTime()) << "us";
+        out << "\n";
+        prevTime = timing.true_;
+    }
+
+    std::vector<Event> evs;
+    for (Event ev = 0; ev < timings_.size(); ++ev)
+        if (timings_[ev].queueDelay()) evs.push_back(ev);
+    std::sort(evs.begin(), evs.end(), [this](const Event aLeft, const Event aRight)
+        { return timings_[aLeft].queueDelay() > timings_[aRight].queueDelay(); });
+    out << "most queued hdlrs:\n";
+    for (size_t idx = 0; idx < evs.size() && idx < aTopN; ++idx)
+        out << "  " << toUs(timings_[evs[idx]].queueDelay()) << "us\t" << dom_.evName(evs[idx]) << "\n";
+
+    evs.clear();
+    for (Event ev = 0; ev < timings_.size(); ++ev)
+        if (timings_[ev].slack_ != NO_SLACK && timings_[ev].slack_ > 0) evs.push_back(ev);
+    std::sort(evs.begin(), evs.end(), [this](const Event aLeft, const Event aRight)
+        { return timings_[aLeft].slack_ < timings_[aRight].slack_; });
+    out << "least slack off path (next to become critical):\n";
+    for (size_t idx = 0; idx < evs.size() && idx < aTopN; ++idx)
+        out << "  " << toUs(timings_[evs[idx]].slack_) << "us\t" << dom_.evName(evs[idx]) << "\n";
+    return out.str();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+const typename BasicCritPath<aEvent>::Timing& BasicCritPath<aEvent>::timing(const EvNameView aEvName) const
+{
+    static const Timing none;
+    const auto ev = dom_.getEventBy(aEvName);
+    return ev < timings_.size() ? timings_[ev] : none;
+}
+
+template class BasicCritPath<uint16_t>;
+template class BasicCritPath<uint32_t>;
+template class BasicCritPath<size_t>;
+}  // namespace
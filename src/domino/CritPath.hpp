@@ -0,0 +1,81 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: which chain of tiles gated a workflow's completion, & what to parallelise
+//   . per event (from 1 Domino's TraceRing records): when it became true, when its hdlr was queued,
+//     started & finished
+//   . gate of event = its predecessor satisfied last (k-th for setNeed()); predecessor = prev (by
+//     prev_, required true) or hdlr that setState() it (eg task hdlr sets its "done" tile)
+//   . critical path = gates from target back to an input; slack = how much later an ancestor of
+//     target could have been true w/o delaying target (0 on critical path)
+// - why: total time of eg eNB upgrade is its critical path; shorten it (split, reorder, parallel
+//   hdlr, less queueing), not the tiles w/ big slack
+// - how: 1 pass over records, then 1 backward pass over target's ancestors (iterative, no recursion)
+// - limit: times are TSC ticks (report() in us by TraceRing::ticksPerUs()); last F->T per event
+//   counts (eg retract & re-fire); true before trace = satisfied at 0 (not a gate); prev required
+//   false is not a gate (its fall is an input)
+// - core: timings_
+// ***********************************************************************************************
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Domino.hpp"
+#include "TraceRing.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aEvent>
+class BasicCritPath
+{
+public:
+    using Event       = aEvent;
+    using EvNameView  = std::string_view;
+    using EvNameViews = std::vector<EvNameView>;
+    static constexpr uint64_t NO_SLACK = UINT64_MAX;  // not ancestor of target
+
+    struct Timing  // TSC ticks, 0 = not in trace
+    {
+        uint64_t true_       = 0;  // last F->T
+        uint64_t hdlrQueued_ = 0;  // last TRIGGER_HDLR
+        uint64_t hdlrBegin_  = 0;
+        uint64_t hdlrEnd_    = 0;
+        Event    gate_       = BasicDomino<aEvent>::D_EVENT_FAILED_RET;  // none: input (or true before trace)
+        uint64_t slack_      = NO_SLACK;
+
+        uint64_t queueDelay() const { return hdlrBegin_ > hdlrQueued_ && hdlrQueued_ ? hdlrBegin_ - hdlrQueued_ : 0; }
+        uint64_t hdlrTime() const { return hdlrEnd_ > hdlrBegin_ && hdlrBegin_ ? hdlrEnd_ - hdlrBegin_ : 0; }
+    };
+
+    // aDom must outlive this & not change topology meanwhile; aSrc = DominoReplay::srcOf(aDom)
+    BasicCritPath(const BasicDomino<aEvent>& aDom, const TraceRing::Records&, const uint32_t aSrc);
+
+    // path & slack to aTarget (empty: the last event became true); false if it never became true
+    bool analyze(const EvNameView aTarget = EvNameView());
+    EvNameViews path() const;                 // input -> ... -> target
+    const Timing& timing(const EvNameView) const;  // unknown EvName: all 0
+    std::string report(const size_t aTopN = 10) const;  // path w/ step times, most queued hdlrs, least slack
+
+private:
+    void predsOf(const Event, std::vector<Event>&) const;  // gating candidates, satisfied before it
+    double toUs(const uint64_t aTicks) const { return aTicks / TraceRing::ticksPerUs(); }
+
+    // -------------------------------------------------------------------------------------------
+    const BasicDomino<aEvent>& dom_;
+    std::vector<Timing> timings_;  // [event]
+    std::vector<Event>  cause_;    // [event]=hdlr (event) whose run setState() it true
+    std::vector<Event>  path_;
+};
+
+using CritPath = BasicCritPath<size_t>;
+
+extern template class BasicCritPath<uint16_t>;
+extern template class BasicCritPath<uint32_t>;
+extern template class BasicCritPath<size_t>;
+}  // namespace
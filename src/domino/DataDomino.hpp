@@ -11,6 +11,7 @@
 
 #include <unordered_map>
 #include <memory>  // make_shared
+#include <vector>
 
 namespace RLib
 {
@@ -24,49 +25,93 @@ class DataDomino : public aDominoType
     // -------------------------------------------------------------------------------------------
 
 public:
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
     // -------------------------------------------------------------------------------------------
     // - for read/write data
     // - if aEvName/data invalid, return null
     // - not template<aDataType> so can virtual for WrDatDom
     // . & let DataDomino has little idea of read-write ctrl, simpler
-    virtual std::shared_ptr<void> getShared(const Domino::EvName& aEvName);
+    virtual std::shared_ptr<void> getShared(const Domino::EvName& aEvName)
+    {
+        return pureGetShared(this->newEvent(aEvName));
+    }
+    virtual std::shared_ptr<void> getShared(const EventHandle aHdl)
+    {
+        return pureGetShared(this->getEventBy(aHdl));
+    }
+    // literal EvName: via handle so derived (eg WbasicDatDom) need not override more
+    std::shared_ptr<void> getShared(const HashedEvName& aEvName) { return getShared(this->newHandle(aEvName)); }
 
-    size_t nShared(const Domino::EvName&) const;
+    size_t nShared(const Domino::EvName& aEvName) const { return pureNShared(this->getEventBy(aEvName)); }
+    size_t nShared(const EventHandle aHdl) const { return pureNShared(this->getEventBy(aHdl)); }
+    size_t nShared(const HashedEvName& aEvName) const { return pureNShared(this->getEventBy(aEvName)); }
 
     // -------------------------------------------------------------------------------------------
     // - replace old data by new=aSharedData if old != new
     // - for aDataType w/o default constructor!!!
-    virtual void replaceShared(const Domino::EvName& aEvName, std::shared_ptr<void> aSharedData);
+    virtual void replaceShared(const Domino::EvName& aEvName, std::shared_ptr<void> aSharedData)
+    {
+        pureReplaceShared(this->newEvent(aEvName), aSharedData);
+    }
+    virtual void replaceShared(const EventHandle aHdl, std::shared_ptr<void> aSharedData)
+    {
+        pureReplaceShared(this->getEventBy(aHdl), aSharedData);
+    }
+    void replaceShared(const HashedEvName& aEvName, std::shared_ptr<void> aSharedData)
+    {
+        replaceShared(this->newHandle(aEvName), aSharedData);
+    }
+
+protected:
+    void forget(const Event aEv) override
+    {
+        dataStore_.erase(aEv);  // data still alive if shared outside
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        this->renumberKeys(dataStore_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
 
 private:
+    std::shared_ptr<void> pureGetShared(const Event);
+    size_t pureNShared(const Event) const;
+    void pureReplaceShared(const Event, std::shared_ptr<void> aSharedData);
+
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, std::shared_ptr<void> > dataStore_;  // [event]=shared_ptr<"DataType">
+    std::unordered_map<Event, std::shared_ptr<void> > dataStore_;  // [event]=shared_ptr<"DataType">
 public:
     using aDominoType::log_;
 };
 
 // ***********************************************************************************************
 template<typename aDominoType>
-std::shared_ptr<void> DataDomino<aDominoType>::getShared(const Domino::EvName& aEvName)
+std::shared_ptr<void> DataDomino<aDominoType>::pureGetShared(const Event aEv)
 {
-    const auto ev = this->newEvent(aEvName);
-    auto&& data = dataStore_[ev];
+    if (aEv == D_EVENT_FAILED_RET) return std::shared_ptr<void>();
+
+    auto&& data = dataStore_[aEv];
     return (data.use_count() > 0) ? data : std::shared_ptr<void>();
 }
 
 // ***********************************************************************************************
 template<typename aDominoType>
-size_t DataDomino<aDominoType>::nShared(const Domino::EvName& aEvName) const
+size_t DataDomino<aDominoType>::pureNShared(const Event aEv) const
 {
-    auto&& found = dataStore_.find(this->getEventBy(aEvName));
+    auto&& found = dataStore_.find(aEv);
     return (found == dataStore_.end()) ? 0 : found->second.use_count();
 }
 
 // ***********************************************************************************************
 template<typename aDominoType>
-void DataDomino<aDominoType>::replaceShared(const Domino::EvName& aEvName, std::shared_ptr<void> aSharedData)
+void DataDomino<aDominoType>::pureReplaceShared(const Event aEv, std::shared_ptr<void> aSharedData)
 {
-    dataStore_[this->newEvent(aEvName)] = aSharedData;
+    if (aEv == D_EVENT_FAILED_RET) return;
+    dataStore_[aEv] = aSharedData;
 }
 
 
@@ -79,11 +124,28 @@ aDataType getValue(aDataDominoType& aDom, const Domino::EvName& aEvName)
     auto&& data = std::static_pointer_cast<aDataType>(aDom.getShared(aEvName));
     if (data.use_count() > 0) return *data;
 
-    auto&& log_ = aDom.log_;
+    [[maybe_unused]] auto&& log_ = aDom.log_;  // unused when CPPLOG_OFF
     WRN("(DataDomino) Failed!!! EvName=" << aEvName << " not found, return undefined obj!!!");
     return aDataType();
 }
 
+template<typename aDataDominoType, typename aDataType>
+aDataType getValue(aDataDominoType& aDom, const typename aDataDominoType::EventHandle aHdl)
+{
+    auto&& data = std::static_pointer_cast<aDataType>(aDom.getShared(aHdl));
+    if (data.use_count() > 0) return *data;
+
+    [[maybe_unused]] auto&& log_ = aDom.log_;  // unused when CPPLOG_OFF
+    WRN("(DataDomino) Failed!!! event=" << aHdl.event() << " not found, return undefined obj!!!");
+    return aDataType();
+}
+
+template<typename aDataDominoType, typename aDataType>
+aDataType getValue(aDataDominoType& aDom, const HashedEvName& aEvName)
+{
+    return getValue<aDataDominoType, aDataType>(aDom, aDom.newHandle(aEvName));
+}
+
 // ***********************************************************************************************
 template<typename aDataDominoType, typename aDataType>
 void setValue(aDataDominoType& aDom, const Domino::EvName& aEvName, const aDataType& aData)
@@ -91,6 +153,16 @@ void setValue(aDataDominoType& aDom, const Domino::EvName& aEvName, const aDataT
     auto&& data = std::make_shared<aDataType>(aData);
     aDom.replaceShared(aEvName, data);
 }
+template<typename aDataDominoType, typename aDataType>
+void setValue(aDataDominoType& aDom, const typename aDataDominoType::EventHandle aHdl, const aDataType& aData)
+{
+    aDom.replaceShared(aHdl, std::make_shared<aDataType>(aData));
+}
+template<typename aDataDominoType, typename aDataType>
+void setValue(aDataDominoType& aDom, const HashedEvName& aEvName, const aDataType& aData)
+{
+    aDom.replaceShared(aDom.newHandle(aEvName), std::make_shared<aDataType>(aData));
+}
 }  // namespace
 // ***********************************************************************************************
 // YYYY-MM-DD  Who       v)Modification Description
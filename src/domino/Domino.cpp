@@ -1,127 +1,1219 @@
 /**
  * Copyright 2018 Nokia. All rights reserved.
  */
+#include <algorithm>  // sort
+#include <charconv>   // from_chars
+#include <istream>
+#include <iterator>   // istreambuf_iterator
+#include <numeric>    // iota
 #include <string>
+#include <unordered_set>
 
 #include "Domino.hpp"
 
 namespace RLib
 {
-size_t Domino::dmnID_ = 0;
-const Domino::EvName Domino::invalidEvName("Invalid Ev/EvName");
+template<class aEvent>
+size_t BasicDomino<aEvent>::dmnID_ = 0;
+template<class aEvent>
+const typename BasicDomino<aEvent>::EvName BasicDomino<aEvent>::invalidEvName("Invalid Ev/EvName");
 
 // ***********************************************************************************************
-void Domino::deduceState(const Event aEv)
+template<class aEvent>
+void BasicDomino<aEvent>::deduceState(const size_t aBase)
 {
-    for (auto&& prevEvent : prev_[true][aEv])
+    // - worklist instead of recursion: no stack overflow for deep chain
+    // - LIFO so same order as recursion; each ev fires at most once per call (no revisit)
+    // - aBase: nested call (eg hdlr's setState()) only handles its own candEvs_ above aBase
+    // - fallEvs_ (setRetract()) 1st, so deduce on settled prevs
+    const auto epoch = ++epoch_;
+    ++nDeducing_;
+    while (candEvs_.size() > aBase || not fallEvs_.empty())
     {
-        if (states_.at(prevEvent) != true) return;
+        if (not fallEvs_.empty())
+        {
+            const auto ev = fallEvs_.back();
+            fallEvs_.pop_back();
+            if (not states_[ev] || enough(ev, nUnsatPrev_[ev])) continue;  // eg prev recovered meanwhile
+
+            firedEpoch_[ev] = 0;  // can re-fire in this pass if prevs recover
+            pureSetState(ev, false);
+            pushNext(ev, false, candEvs_);
+            continue;
+        }
+
+        const auto ev = candEvs_.back();
+        candEvs_.pop_back();
+        if (not enough(ev, nUnsatPrev_[ev]) || firedEpoch_[ev] == epoch) continue;
+
+        firedEpoch_[ev] = epoch;
+        pureSetState(ev, true);
+        pushNext(ev, true, candEvs_);  // after pureSetState() since hdlr may setPrev()
+    }
+    --nDeducing_;
+    journalBatch(aBase);
+}
+
+// ***********************************************************************************************
+// same as deduceState() but for 1 thread's components; no write to states_ (bitmap: neighbor
+// bits share word) nor log (not thread-safe), F->T recorded into aFired instead
+template<class aEvent>
+void BasicDomino<aEvent>::deduceAlone(const OrderedEvs& aCands, const size_t aEpoch, OrderedEvs& aFired)
+{
+    std::vector<Event> candEvs;
+    for (auto&& cand : aCands)
+    {
+        candEvs.push_back(cand.second);
+        while (not candEvs.empty())
+        {
+            const auto ev = candEvs.back();
+            candEvs.pop_back();
+            if (not enough(ev, nUnsatPrev_[ev]) || firedEpoch_[ev] == aEpoch) continue;
+
+            firedEpoch_[ev] = aEpoch;
+            if (not states_[ev])  // only caller thread writes states_, after all workers done
+            {
+                countUnsat(ev, true);
+                aFired.emplace_back(cand.first, ev);
+            }
+            pushNext(ev, true, candEvs);
+        }
+    }
+}
+
+// ***********************************************************************************************
+// - serial pops candEvs_ from top, & each candidate's whole cascade is done before next candidate;
+//   components share no edge, so each component alone deduces the same as serial
+// - fired events tagged w/ candidate's serial order, so merge restores exact serial effect() order
+template<class aEvent>
+bool BasicDomino<aEvent>::deduceParallel(const size_t aBase)
+{
+    const auto nCand = candEvs_.size() - aBase;
+    if (nThread_ <= 1 || nCand < minCand_ || retract_) return false;  // fallEvs_ not per thread
+
+    std::unordered_map<Event, size_t> thrdOfComp;  // round robin
+    std::vector<OrderedEvs> thrdCands(nThread_);
+    for (size_t order = 0; order < nCand; ++order)
+    {
+        const auto ev = candEvs_[candEvs_.size() - 1 - order];
+        auto&& thrd = thrdOfComp.emplace(compOf(ev), thrdOfComp.size() % nThread_).first->second;
+        thrdCands[thrd].emplace_back(order, ev);
+    }
+    if (thrdOfComp.size() < 2) return false;
+
+    candEvs_.resize(aBase);
+    const auto epoch = ++epoch_;
+    std::vector<OrderedEvs> thrdFired(nThread_);
+    if (not pool_.workers_ || pool_.workers_->nWorker() + 1 != nThread_)  // eg copied Domino
+        pool_.workers_ = std::make_unique<WorkerPool>(nThread_ - 1);
+    pool_.workers_->run([this, &thrdCands, &thrdFired, epoch](const size_t aThrd)
+    {
+        deduceAlone(thrdCands[aThrd], epoch, thrdFired[aThrd]);
+    }, std::min(nThread_, thrdOfComp.size()));
+
+    OrderedEvs fired;
+    for (auto&& evs : thrdFired) fired.insert(fired.end(), evs.begin(), evs.end());
+    std::stable_sort(fired.begin(), fired.end(),  // same order in 1 thread = same candidate
+        [](const auto& aLeft, const auto& aRight) { return aLeft.first < aRight.first; });
+    ++nDeducing_;
+    for (auto&& it : fired)
+    {
+        states_[it.second] = true;
+        trace(TraceRing::STATE_TRUE, it.second);
+        journalState(it.second, true);
+        exportState(it.second, true);
+        DBG("Succeed, EvName=" << evName(it.second) << " newState=true");
+        trace(TraceRing::EFFECT, it.second);
+        effect(it.second);
+        sthChanged_ = true;
+    }
+    --nDeducing_;
+    HID("nCand=" << nCand << ", nComp=" << thrdOfComp.size() << ", nFired=" << fired.size());
+    journalBatch(aBase);
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+BasicDomino<aEvent>::~BasicDomino()
+{
+    for (auto&& itDown : mounts_.down_) itDown.second.dom_->mounts_.up_.erase(itDown.second.ev_);
+    for (auto&& itUp : mounts_.up_) itUp.second.dom_->mounts_.down_.erase(itUp.second.ev_);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Topo& BasicDomino<aEvent>::editTopo()
+{
+    if (sharedTopo())
+    {
+        topo_ = std::make_shared<Topo>(*topo_);
+        HID("copied shared topology, nEvent=" << nEvent());
+    }
+    return *topo_;
+}
+
+// ***********************************************************************************************
+// - setPrev() buffers edges in EdgeCsr's overflow_, so a graph never frozen would deduce via hash lookup
+// - merge at top-level setState() (1st after setup): nested one (eg hdlr's) may be in an index loop of
+//   caller, shared topology may be walked by another Domino
+// - topological layout as freeze()
+template<class aEvent>
+void BasicDomino<aEvent>::flatten()
+{
+    if (nDeducing_ > 0 || sharedTopo()) return;
+    if (topo_->prev_.flat() && topo_->next_.flat()) return;
+
+    auto&& topo = editTopo();
+    topo.prev_.compact(topo.evOfOrd_);
+    topo.next_.compact(topo.evOfOrd_);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::nUnsatOf(const Event aEv, const Topo& aTopo,
+    const std::vector<bool>& aStates)
+{
+    Event nUnsat = 0;
+    for (size_t idx = 0, nPrev = aTopo.prev_.degree(aEv); idx < nPrev; ++idx)
+    {
+        auto&& prevEdge = aTopo.prev_.at(aEv, idx);
+        if (aStates[EdgeCsr::nodeOf(prevEdge)] != EdgeCsr::flagOf(prevEdge)) ++nUnsat;
+    }
+    return nUnsat;
+}
+
+// ***********************************************************************************************
+// order-free per event's prevs, so same topology = same hash whatever built by (setPrev(), load(), etc)
+template<class aEvent>
+uint64_t BasicDomino<aEvent>::topoHash() const
+{
+    auto&& fold = [](const uint64_t aHash, const uint64_t aWord) { return (aHash ^ aWord) * 1099511628211ull; };
+    auto hash = fold(HashedEvName::hashOf(""), nEvent());
+    for (Event ev = 0; ev < nEvent(); ++ev)
+    {
+        if (topo_->evNames_.removed(ev))
+        {
+            hash = fold(hash, D_EVENT_FAILED_RET);
+            continue;
+        }
+        uint64_t prevSum = 0;
+        for (size_t idx = 0, nPrev = topo_->prev_.degree(ev); idx < nPrev; ++idx)
+            prevSum += (uint64_t(topo_->prev_.at(ev, idx)) + 1) * 0x9E3779B97F4A7C15ull;
+        hash = fold(fold(fold(hash, HashedEvName::hashOf(evName(ev))), topo_->need_[ev]), prevSum);
+    }
+    return hash;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::checkpoint(const std::string& aSnapshotPath)
+{
+    const auto tmpPath = aSnapshotPath + ".tmp";  // old snapshot stays till new one complete
+    if (not journal_.file_ || not journal_.file_->commit() || not save(tmpPath)
+        || not DominoSnapshot::replace(tmpPath, aSnapshotPath) || not journal_.file_->reset(topoHash()))
+    {
+        WRN("!!!Failed, snapshot=" << aSnapshotPath << " (no journal, or write failed)");
+        return false;
+    }
+    HID("Succeed, snapshot=" << aSnapshotPath << ", nEvent=" << nEvent());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::closeJournal()
+{
+    journal_.file_.reset();  // commit & close
+    journal_.done_.clear();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::commitJournal()
+{
+    return journal_.file_ && journal_.file_->commit();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::compact()
+{
+    if (frozen() || nDeducing_ > 0)
+    {
+        WRN("!!!Failed, can't compact since frozen (thaw() 1st) or in broadcast");
+        return false;
+    }
+
+    const auto nRm = nRemoved();
+    if (nRm == 0)
+    {
+        HID("nothing removed, nEvent=" << nEvent());
+        return true;  // keep shared topology & EventHandles
+    }
+
+    journalTopo();  // renumber
+    auto&& topo = editTopo();
+    const auto newOfName = topo.evNames_.compact();
+    const std::vector<Event> newOf(newOfName.begin(), newOfName.end());  // NOT_FOUND -> D_EVENT_FAILED_RET
+    const auto nLive = topo.evNames_.size();
+    topo.prev_.renumber(newOf);
+    topo.next_.renumber(newOf);
+
+    std::vector<Event> need(nLive), nUnsatPrev(nLive), ord(nLive), evOfOrd;
+    std::vector<bool> states(nLive);
+    for (size_t ev = 0; ev < newOf.size(); ++ev)
+    {
+        if (newOf[ev] == D_EVENT_FAILED_RET) continue;
+        need[newOf[ev]] = topo.need_[ev];
+        nUnsatPrev[newOf[ev]] = nUnsatPrev_[ev];
+        states[newOf[ev]] = states_[ev];
+    }
+    evOfOrd.reserve(nLive);
+    for (auto&& ev : topo.evOfOrd_)  // same relative order, still topological
+    {
+        if (newOf[ev] == D_EVENT_FAILED_RET) continue;
+        ord[newOf[ev]] = Event(evOfOrd.size());
+        evOfOrd.push_back(newOf[ev]);
     }
-    for (auto&& prevEvent : prev_[false][aEv])
+    topo.need_.swap(need);
+    topo.ord_.swap(ord);
+    topo.evOfOrd_.swap(evOfOrd);
+    nUnsatPrev_.swap(nUnsatPrev);
+    states_.swap(states);
+    std::vector<size_t>(nLive, 0).swap(firedEpoch_);
+    candEvs_.shrink_to_fit();
+    fallEvs_.shrink_to_fit();
+    setEvs_.shrink_to_fit();
+
+    std::vector<Event>(nLive).swap(topo.compUp_);  // rebuild since rmEvent() can't split
+    std::iota(topo.compUp_.begin(), topo.compUp_.end(), Event(0));
+    std::vector<Event>(nLive, 1).swap(topo.compSize_);
+    topo.nComp_ = nLive;
+    for (Event ev = 0; ev < nLive; ++ev)
+        for (size_t idx = 0, nNext = topo.next_.degree(ev); idx < nNext; ++idx)
+            joinComp(ev, EdgeCsr::nodeOf(topo.next_.at(ev, idx)));
+
+    for (auto&& itUp : mounts_.up_) itUp.second.dom_->mounts_.down_.at(itUp.second.ev_).ev_ = newOf[itUp.first];
+    for (auto&& itDown : mounts_.down_) itDown.second.dom_->mounts_.up_.at(itDown.second.ev_).ev_ = newOf[itDown.first];
+    renumberKeys(mounts_.up_, newOf);
+    renumberKeys(mounts_.down_, newOf);
+    renumberKeys(journal_.done_, newOf);
+    renumber(newOf);
+
+    id_ = dmnID_++;  // refuse old EventHandles
+    rmGen_.clear();
+    HID("Succeed, nEvent=" << nEvent() << ", nRemoved=" << nRm << ", nEdge=" << topo.next_.nEdge());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::compOf(Event aEv) const
+{
+    while (topo_->compUp_[aEv] != aEv) aEv = topo_->compUp_[aEv];
+    return aEv;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::joinComp(const Event aEv, const Event aOther)
+{
+    auto root = compOf(aEv);
+    auto other = compOf(aOther);
+    if (root == other) return;
+
+    auto&& topo = editTopo();
+    if (topo.compSize_[root] < topo.compSize_[other]) std::swap(root, other);
+    topo.compUp_[other] = root;
+    topo.compSize_[root] += topo.compSize_[other];
+    --topo.nComp_;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::countUnsat(const Event aEv, const bool aNewState)
+{
+    for (size_t idx = 0, nNext = topo_->next_.degree(aEv); idx < nNext; ++idx)
     {
-        if (states_.at(prevEvent) != false) return;
+        auto&& nextEdge = topo_->next_.at(aEv, idx);
+        const auto nextEv = EdgeCsr::nodeOf(nextEdge);
+        if (EdgeCsr::flagOf(nextEdge) == aNewState) --nUnsatPrev_[nextEv];
+        else
+        {
+            ++nUnsatPrev_[nextEv];
+            if (retract_ && states_[nextEv] && not enough(nextEv, nUnsatPrev_[nextEv])) fallEvs_.push_back(nextEv);
+        }
     }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::freeze()
+{
+    if (frozen()) return;
+    if (nRemoved() > 0) compact();  // EvName index can't perfect-hash removed slots
+
+    const auto order = topoOrder();
+    auto&& topo = editTopo();
+    topo.prev_.compact(order);
+    topo.next_.compact(order);
+    if (not topo.evNames_.freeze())
+        WRN("EvName index not perfect-hashed (nHashCollision=" << nHashCollision() << "), still correct but slower");
+
+    topo.frozen_ = true;
+    HID("Succeed, nEvent=" << nEvent() << ", nEdge=" << topo.next_.nEdge());
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+std::function<void()> BasicDomino<aEvent>::doneNote(const Event aEv) const
+{
+    return [journal = std::weak_ptr<DominoJournal>(journal_.file_), aEv]
+    {
+        if (auto&& file = journal.lock()) file->append(aEv, DominoJournal::HDLR_DONE);
+    };
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::exportState(const Event aEv, const bool aNewState)
+{
+    if (mounts_.up_.empty()) return;  // most
+    const auto itUp = mounts_.up_.find(aEv);
+    if (itUp == mounts_.up_.end()) return;
+
+    DBG("EvName=" << evName(aEv) << " newState=" << aNewState << " to parent " << itUp->second.dom_->log_.prefix_);
+    itUp->second.dom_->pureSetOne(itUp->second.ev_, aNewState);  // parent's own worklist
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::getEventBy(const HashedEvName& aEvName) const
+{
+    const auto event = topo_->evNames_.find(aEvName);
+    return event == EvNameStore::NOT_FOUND ? D_EVENT_FAILED_RET : Event(event);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::getEventBy(const EventHandle aHdl) const
+{
+    if (aHdl.dmnID_ == id_ && aHdl.ev_ < nEvent() && not topo_->evNames_.removed(aHdl.ev_)
+        && aHdl.gen_ == rmGen(aHdl.ev_))
+        return aHdl.ev_;
 
-    pureSetState(aEv, true);
-    for (auto&& nextEvent : next_[true][aEv]) deduceState(nextEvent);
+    WRN("!!!Failed, invalid EventHandle of Domino id=" << aHdl.dmnID_ << ", event id=" << aHdl.ev_);
+    return D_EVENT_FAILED_RET;
 }
 
 // ***********************************************************************************************
-Domino::Event Domino::getEventBy(const EvName& aEvName) const
+template<class aEvent>
+void BasicDomino<aEvent>::journalState(const Event aEv, const bool aNewState)
 {
-    auto&& it = events_.find(aEvName);
-    if (it == events_.end()) return D_EVENT_FAILED_RET;
-    return it->second;
+    if (not journal_.file_) return;
+    journal_.file_->append(aEv, aNewState ? DominoJournal::SET_TRUE : DominoJournal::SET_FALSE);
+    if (not journal_.done_.empty()) journal_.done_.erase(aEv);  // new change, old hdlr done not apply
 }
 
 // ***********************************************************************************************
-Domino::Event Domino::newEvent(const EvName& aEvName)
+template<class aEvent>
+bool BasicDomino<aEvent>::load(const std::string& aPath)
+{
+    if (nEvent() > 0)
+    {
+        WRN("!!!Failed, can't load since already has nEvent=" << nEvent());
+        return false;
+    }
+
+    DominoSnapshot snap;
+    auto topo = std::make_shared<Topo>();
+    auto&& tagOf = DominoSnapshot::tagOf;
+    bool valid = snap.open(aPath) && snap.eventBytes() == sizeof(Event) && topo->evNames_.load(snap);
+    const auto nEv = topo->evNames_.size();
+    std::vector<bool> states, frozen;
+    std::vector<Event> nUnsatPrev;
+    std::vector<uint64_t> nComp;
+    valid = valid && nEv <= size_t(MAX_EVENT) + 1
+        && topo->prev_.load(snap, tagOf("prvR"), tagOf("prvE"), nEv)
+        && topo->next_.load(snap, tagOf("nxtR"), tagOf("nxtE"), nEv)
+        && snap.get(tagOf("need"), topo->need_, nEv) && snap.get(tagOf("ordr"), topo->evOfOrd_, nEv)
+        && snap.get(tagOf("cpUp"), topo->compUp_, nEv) && snap.get(tagOf("cpSz"), topo->compSize_, nEv)
+        && snap.get(tagOf("nCmp"), nComp, 1) && snap.get(tagOf("frzn"), frozen, 1)
+        && snap.get(tagOf("stat"), states, nEv) && snap.get(tagOf("nUns"), nUnsatPrev, nEv);
+    topo->ord_.assign(nEv, 0);
+    std::vector<bool> seen(valid ? nEv : 0, false);  // evOfOrd_ shall be a permutation
+    for (size_t idx = 0; valid && idx < nEv; ++idx)
+    {
+        const auto ev = topo->evOfOrd_[idx];
+        valid = ev < nEv && not seen[ev] && topo->compUp_[idx] < nEv;
+        if (not valid) break;
+        seen[ev] = true;
+        topo->ord_[ev] = Event(idx);
+    }
+    for (Event ev = 0; valid && ev < nEv; ++ev) valid = nUnsatPrev[ev] == nUnsatOf(ev, *topo, states);  // O(nEdge)
+    if (not valid || not loadExt(snap, nEv))
+    {
+        WRN("!!!Failed, invalid snapshot=" << aPath << " (no file, other version/Event width, or corrupted)");
+        return false;
+    }
+
+    topo->nComp_ = nComp[0];
+    topo->frozen_ = frozen[0];
+    journalTopo();
+    topo_ = topo;
+    states_.swap(states);
+    nUnsatPrev_.swap(nUnsatPrev);
+    firedEpoch_.assign(nEv, 0);
+    HID("Succeed, snapshot=" << aPath << ", nEvent=" << nEvent() << ", frozen=" << this->frozen());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::loadGraph(const std::vector<EvNameView>& aEvNames, const std::vector<GraphEdge>& aEdges)
+{
+    const auto nEv = aEvNames.size();
+    if (nEvent() > 0 || frozen() || nEv > size_t(MAX_EVENT) + 1)
+    {
+        WRN("!!!Failed, can't loadGraph() into nEvent=" << nEvent() << " (shall be empty & not frozen), or nEvName="
+            << nEv << " over max of " << sizeof(Event) * 8 << "-bit Event");
+        return false;
+    }
+
+    auto topo = std::make_shared<Topo>();  // commit only if all valid
+    size_t nNameBytes = 0;
+    for (auto&& name : aEvNames) nNameBytes += name.size();
+    topo->evNames_.reserve(nEv, nNameBytes);
+    for (auto&& name : aEvNames)
+    {
+        const HashedEvName hashed(name);
+        if (topo->evNames_.find(hashed) != EvNameStore::NOT_FOUND)
+        {
+            WRN("!!!Failed, dup EvName=" << name);
+            return false;
+        }
+        topo->evNames_.add(hashed);
+    }
+
+    std::vector<Event> prevFroms, prevEdges, nextFroms, nextEdges;  // [i]=aEdges[i] in prev_ & next_
+    for (auto&& vec : {&prevFroms, &prevEdges, &nextFroms, &nextEdges}) vec->reserve(aEdges.size());
+    for (auto&& edge : aEdges)
+    {
+        if (edge.prev >= nEv || edge.next >= nEv || edge.prev == edge.next)
+        {
+            WRN("!!!Failed, invalid edge prev=" << edge.prev << ", next=" << edge.next << " in nEvent=" << nEv);
+            return false;
+        }
+        prevFroms.push_back(Event(edge.next));
+        prevEdges.push_back(EdgeCsr::toEdge(Event(edge.prev), edge.prevState));
+        nextFroms.push_back(Event(edge.prev));
+        nextEdges.push_back(EdgeCsr::toEdge(Event(edge.next), edge.prevState));
+    }
+    topo->prev_.build(nEv, prevFroms, prevEdges);
+    topo->next_.build(nEv, nextFroms, nextEdges);
+
+    std::vector<Event> block;
+    for (Event ev = 0; ev < nEv; ++ev)  // dup edge: sort a copy, so edge order kept
+    {
+        const auto nPrev = topo->prev_.degree(ev);
+        if (nPrev < 2) continue;
+        block.clear();
+        for (size_t idx = 0; idx < nPrev; ++idx) block.push_back(topo->prev_.at(ev, idx));
+        std::sort(block.begin(), block.end());
+        if (std::adjacent_find(block.begin(), block.end()) == block.end()) continue;
+        WRN("!!!Failed, dup edge to EvName=" << aEvNames[ev]);
+        return false;
+    }
+
+    std::vector<Event> nPrevLeft(nEv);  // Kahn: ordered once all its prevs ordered
+    topo->evOfOrd_.reserve(nEv);
+    for (Event ev = 0; ev < nEv; ++ev)
+    {
+        nPrevLeft[ev] = Event(topo->prev_.degree(ev));
+        if (nPrevLeft[ev] == 0) topo->evOfOrd_.push_back(ev);
+    }
+    for (size_t idx = 0; idx < topo->evOfOrd_.size(); ++idx)
+    {
+        const auto ev = topo->evOfOrd_[idx];
+        for (size_t iNext = 0, nNext = topo->next_.degree(ev); iNext < nNext; ++iNext)
+        {
+            const auto nextEv = EdgeCsr::nodeOf(topo->next_.at(ev, iNext));
+            if (--nPrevLeft[nextEv] == 0) topo->evOfOrd_.push_back(nextEv);
+        }
+    }
+    if (topo->evOfOrd_.size() != nEv)
+    {
+        WRN("!!!Failed, dead-loop among " << nEv - topo->evOfOrd_.size() << " events");
+        return false;
+    }
+
+    topo->ord_.resize(nEv);
+    for (size_t idx = 0; idx < nEv; ++idx) topo->ord_[topo->evOfOrd_[idx]] = Event(idx);
+    topo->need_.assign(nEv, 0);
+    topo->compUp_.resize(nEv);
+    std::iota(topo->compUp_.begin(), topo->compUp_.end(), Event(0));
+    topo->compSize_.assign(nEv, 1);
+    topo->nComp_ = nEv;
+
+    journalTopo();
+    topo_ = std::move(topo);  // not shared, so joinComp() edits in place
+    states_.assign(nEv, false);
+    nUnsatPrev_.assign(nEv, 0);
+    firedEpoch_.assign(nEv, 0);
+    for (auto&& edge : aEdges)
+    {
+        joinComp(Event(edge.next), Event(edge.prev));
+        if (edge.prevState) ++nUnsatPrev_[edge.next];  // all false yet
+    }
+    for (auto&& ev : topo_->evOfOrd_)  // prevs settled 1st, so no broadcast needed
+        if (topo_->prev_.degree(ev) > 0 && enough(ev, nUnsatPrev_[ev])) pureSetState(ev, true);
+    HID("Succeed, nEvent=" << nEvent() << ", nEdge=" << topo_->next_.nEdge() << ", nComponent=" << nComponent());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::loadGraph(std::istream& aText)
+{
+    const std::string text((std::istreambuf_iterator<char>(aText)), std::istreambuf_iterator<char>());
+    EvNameView rest(text);
+    EvNameView line;
+    const auto nextLine = [&rest, &line]  // skip empty & '#' lines
+    {
+        while (not rest.empty())
+        {
+            const auto end = std::min(rest.find('\n'), rest.size());
+            line = rest.substr(0, end);
+            rest.remove_prefix(std::min(end + 1, rest.size()));
+            if (not line.empty() && line.back() == '\r') line.remove_suffix(1);
+            if (not line.empty() && line.front() != '#') return true;
+        }
+        return false;
+    };
+    const auto nextNum = [&line](size_t& aNum)
+    {
+        while (not line.empty() && (line.front() == ' ' || line.front() == '\t')) line.remove_prefix(1);
+        const auto res = std::from_chars(line.data(), line.data() + line.size(), aNum);
+        line.remove_prefix(res.ptr - line.data());
+        return res.ec == std::errc();
+    };
+    const auto lineEnd = [&line] { return line.find_first_not_of(" \t") == EvNameView::npos; };
+
+    size_t nEv = 0;
+    size_t nEdge = 0;
+    bool valid = nextLine() && nextNum(nEv) && nextNum(nEdge) && lineEnd();
+    std::vector<EvNameView> evNames;  // into text, no copy
+    evNames.reserve(std::min(nEv, text.size()));  // not trust header for mem
+    while (valid && evNames.size() < nEv)
+    {
+        valid = nextLine();
+        evNames.push_back(line);
+    }
+    std::vector<GraphEdge> edges;
+    edges.reserve(std::min(nEdge, text.size()));
+    for (size_t prevState = 0; valid && edges.size() < nEdge;)
+    {
+        GraphEdge edge{};
+        valid = nextLine() && nextNum(edge.prev) && nextNum(edge.next) && nextNum(prevState) && prevState <= 1
+            && lineEnd();
+        edge.prevState = prevState;
+        edges.push_back(edge);
+    }
+    if (not valid || nextLine())
+    {
+        WRN("!!!Failed, invalid graph text (nEvent=" << nEv << ", nEdge=" << nEdge << ") near line=" << line);
+        return false;
+    }
+    return loadGraph(evNames, edges);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::MemFootprint BasicDomino<aEvent>::memFootprint() const
+{
+    MemFootprint mem;
+    mem.evNames_  = topo_->evNames_.nNameBytes();
+    mem.evIndex_  = topo_->evNames_.nIndexBytes();
+    mem.edges_    = topo_->prev_.nBytes() + topo_->next_.nBytes()
+        + (topo_->need_.capacity() + topo_->compUp_.capacity() + topo_->compSize_.capacity()) * sizeof(Event)
+        + (topo_->ord_.capacity() + topo_->evOfOrd_.capacity()) * sizeof(Event);
+    mem.perEvent_ = states_.capacity() / 8 + nUnsatPrev_.capacity() * sizeof(Event)
+        + firedEpoch_.capacity() * sizeof(size_t) + (candEvs_.capacity() + fallEvs_.capacity()) * sizeof(Event)
+        + setEvs_.capacity() * sizeof(setEvs_[0])
+        + rmGen_.size() * (sizeof(Event) + sizeof(uint32_t));
+    return mem;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::newEvent(const HashedEvName& aEvName)
 {
     auto&& event = getEventBy(aEvName);
     if (event != D_EVENT_FAILED_RET) return event;
 
-    event = states_.size();
-    HID("Succeed, EvName=" << aEvName << ", event id=" << event);
-    events_.emplace(aEvName, event);
-    evNames_.push_back(aEvName);
-    states_.push_back(false);
+    if (frozen())
+    {
+        WRN("!!!Failed, can't add EvName=" << aEvName.name() << " since frozen (thaw() 1st)");
+        return D_EVENT_FAILED_RET;
+    }
+    if (nEvent() > MAX_EVENT && nRemoved() == 0)
+    {
+        WRN("!!!Failed, can't add EvName=" << aEvName.name() << " since nEvent=" << nEvent()
+            << " reaches max of " << sizeof(Event) * 8 << "-bit Event (use wider BasicDomino)");
+        return D_EVENT_FAILED_RET;
+    }
+
+    journalTopo();
+    auto&& topo = editTopo();
+    auto&& evNames = topo.evNames_;
+    const auto nCollision = evNames.nCollision();
+    event = Event(evNames.add(aEvName));
+    if (event < nEvent())  // reuse rmEvent()'s: reset there, keep its ord_ & component (still valid)
+    {
+        if (topo.compUp_[event] == event && topo.compSize_[event] == 1) ++topo.nComp_;
+    }
+    else
+    {
+        topo.compUp_.push_back(event);
+        topo.compSize_.push_back(1);
+        ++topo.nComp_;
+        topo.need_.push_back(0);
+        topo.ord_.push_back(event);  // new = last in topological order
+        topo.evOfOrd_.push_back(event);
+        states_.push_back(false);
+        nUnsatPrev_.push_back(0);
+        firedEpoch_.push_back(0);
+    }
+    HID("Succeed, EvName=" << aEvName.name() << ", event id=" << event);
+    if (evNames.nCollision() != nCollision)
+        WRN("!!!hash collision (still correct but slower), EvName=" << aEvName.name() << ", hash=" << aEvName.hash());
     return event;
 }
 
 // ***********************************************************************************************
-void Domino::pureSetState(const Event aEv, const bool aNewState)
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::mount(const EvNameView aTile, BasicDomino& aChild,
+    const EvNameView aChildEv)
+{
+    if (&aChild == this)
+    {
+        WRN("!!!Failed, can't mount self as child, tile=" << aTile);
+        return D_EVENT_FAILED_RET;
+    }
+    const auto childEv = aChild.newEvent(aChildEv);
+    const auto tile = newEvent(aTile);
+    if (childEv == D_EVENT_FAILED_RET || tile == D_EVENT_FAILED_RET
+        || aChild.mounts_.up_.count(childEv) || mounts_.down_.count(tile))
+    {
+        WRN("!!!Failed, tile=" << aTile << " or child " << aChild.log_.prefix_ << "'s EvName=" << aChildEv
+            << " invalid (eg frozen) or already mounted");
+        return D_EVENT_FAILED_RET;
+    }
+
+    aChild.mounts_.up_.emplace(childEv, Link{this, tile});
+    mounts_.down_.emplace(tile, Link{&aChild, childEv});
+    HID("Succeed, tile=" << aTile << " follows " << aChild.log_.prefix_ << "'s EvName=" << aChildEv);
+    pureSetOne(tile, aChild.states_[childEv]);
+    return tile;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::unmount(const EvNameView aTile)
+{
+    const auto itDown = mounts_.down_.find(getEventBy(aTile));
+    if (itDown == mounts_.down_.end())
+    {
+        WRN("!!!Failed, tile=" << aTile << " not mounted");
+        return false;
+    }
+    itDown->second.dom_->mounts_.up_.erase(itDown->second.ev_);
+    mounts_.down_.erase(itDown);
+    HID("Succeed, tile=" << aTile << " keeps state=" << state(aTile));
+    return true;
+}
+
+// ***********************************************************************************************
+// replay on states_ directly (O(1) per record, no effect()), then recount nUnsatPrev_ once
+template<class aEvent>
+bool BasicDomino<aEvent>::openJournal(const std::string& aPath, const size_t aBatch)
+{
+    std::vector<DominoJournal::Record> records;
+    auto journal = std::make_shared<DominoJournal>();
+    if (journaled() || not journal->open(aPath, sizeof(Event), topoHash(), records))
+    {
+        WRN("!!!Failed, journal=" << aPath << " can't open, already journaled, of other topology/Event width, or "
+            "topology changed w/o checkpoint()");
+        return false;
+    }
+    for (auto&& rec : records)
+    {
+        const auto ev = DominoJournal::eventOf(rec);
+        if (ev < nEvent() && not topo_->evNames_.removed(ev)) continue;
+        WRN("!!!Failed, journal=" << aPath << " has invalid event=" << ev << " (topology changed w/o checkpoint()?)");
+        return false;
+    }
+
+    for (auto&& rec : records)
+    {
+        const auto kind = DominoJournal::kindOf(rec);
+        if (kind != DominoJournal::HDLR_DONE) states_[DominoJournal::eventOf(rec)] = kind == DominoJournal::SET_TRUE;
+    }
+    for (Event ev = 0; ev < nEvent(); ++ev) nUnsatPrev_[ev] = nUnsatOf(ev, *topo_, states_);
+    journal_.done_.clear();
+    for (auto&& it : journal->done())
+        if (states_[it.first]) journal_.done_.emplace(Event(it.first), it.second);  // hdlr done after fell: no use
+
+    journal->setBatch(aBatch);
+    journal_.file_ = journal;
+    HID("Succeed, journal=" << aPath << ", nReplayed=" << records.size() << ", nDoneEv=" << journal_.done_.size());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::pushNext(const Event aEv, const bool aState, std::vector<Event>& aCandEvs) const
+{
+    for (auto idx = topo_->next_.degree(aEv); idx > 0; --idx)
+    {
+        auto&& nextEdge = topo_->next_.at(aEv, idx - 1);
+        if (EdgeCsr::flagOf(nextEdge) == aState) aCandEvs.push_back(EdgeCsr::nodeOf(nextEdge));
+    }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::pureSetState(const Event aEv, const bool aNewState)
 {
     if (states_[aEv] != aNewState)
     {
         states_[aEv] = aNewState;
-        DBG("Succeed, EvName=" << evNames_[aEv] << " newState=" << aNewState);
-        if (aNewState == true) effect(aEv);
+        trace(aNewState ? TraceRing::STATE_TRUE : TraceRing::STATE_FALSE, aEv);
+        journalState(aEv, aNewState);
+        countUnsat(aEv, aNewState);
+        ++nDeducing_;  // also setState()'s own events, before deduceState()
+        exportState(aEv, aNewState);
+        DBG("Succeed, EvName=" << evName(aEv) << " newState=" << aNewState);
+        if (aNewState == true)
+        {
+            trace(TraceRing::EFFECT, aEv);
+            effect(aEv);
+        }
+        --nDeducing_;
 
         sthChanged_ = true;
     }
 }
 
 // ***********************************************************************************************
-Domino::Event Domino::setPrev(const EvName& aEvName, const SimuEvents& aSimuPrevEvents)
+template<class aEvent>
+template<class aSimuEvs>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::purePrev(const Event aEv, const aSimuEvs& aSimuPrevEvents)
 {
-    auto&& event = newEvent(aEvName);
+    if (aEv == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
+    if (frozen())
+    {
+        WRN("!!!Failed, can't setPrev() of EvName=" << evName(aEv) << " since frozen (thaw() 1st)");
+        return D_EVENT_FAILED_RET;
+    }
+
+    auto&& event = aEv;
     for (auto&& itSim : aSimuPrevEvents)
     {
         if (event == getEventBy(itSim.first))
         {
-            WRN("!!!Failed, can't set self as previous event (=loop self), EvName=" << aEvName);
+            WRN("!!!Failed, can't set self as previous event (=loop self), EvName=" << evName(event));
             return D_EVENT_FAILED_RET;
         }
+        const auto prevEv = getEventBy(itSim.first);  // new prev can't loop
+        if (prevEv != D_EVENT_FAILED_RET && topo_->ord_[prevEv] > topo_->ord_[event])
+        {
+            std::vector<Event> affected;
+            if (reachInOrder(event, true, topo_->ord_[prevEv], affected, prevEv))
+            {
+                WRN("!!!Failed, can't set " << itSim.first << " as previous event of EvName=" << evName(event)
+                    << " since it's already a (indirect) next (=dead-loop)");
+                return D_EVENT_FAILED_RET;
+            }
+        }
     }
 
     for (auto&& itSim : aSimuPrevEvents)
     {
         auto&& prevEv = newEvent(itSim.first);
-        prev_[itSim.second][event].insert(prevEv);
-        next_[itSim.second][prevEv].insert(event);
-        DBG("Succeed, EvName=" << aEvName << ", preEvent=" << itSim.first << ", preEventState=" << itSim.second);
+        auto&& prevEdge = EdgeCsr::toEdge(prevEv, itSim.second);
+        auto&& nextEdge = EdgeCsr::toEdge(event, itSim.second);
+        const bool isDup = topo_->prev_.degree(event) < topo_->next_.degree(prevEv)  // check shorter one
+            ? topo_->prev_.has(event, prevEdge)
+            : topo_->next_.has(prevEv, nextEdge);
+        if (isDup) continue;
+
+        journalTopo();
+        auto&& topo = editTopo();
+        topo.prev_.add(event, prevEdge);
+        topo.next_.add(prevEv, nextEdge);
+        joinComp(event, prevEv);
+        if (topo.ord_[prevEv] > topo.ord_[event]) reorder(prevEv, event);
+        if (states_[prevEv] != itSim.second) ++nUnsatPrev_[event];
+        if (retract_ && states_[event] && not enough(event, nUnsatPrev_[event])) fallEvs_.push_back(event);
+        DBG("Succeed, EvName=" << evName(event) << ", preEvent=" << itSim.first << ", preEventState=" << itSim.second);
     }
-    deduceState(event);
+    const auto base = candEvs_.size();
+    candEvs_.push_back(event);
+    deduceState(base);
     return event;
 }
 
 // ***********************************************************************************************
-void Domino::setState(const SimuEvents& aSimuEvents)
+template<class aEvent>
+template<class aSimuEvs>
+void BasicDomino<aEvent>::pureSetStates(const aSimuEvs& aSimuEvents)
 {
     sthChanged_ = false;
+    flatten();
 
-    for (auto&& itSim : aSimuEvents) pureSetState(newEvent(itSim.first), itSim.second);
+    trace(TraceRing::SET_BEGIN, aSimuEvents.size());
+    const auto setBase = setEvs_.size();  // nested setState() (eg sync hdlr) uses above
     for (auto&& itSim : aSimuEvents)
     {
-        for (auto&& nextEvent : next_[itSim.second][events_[itSim.first]]) deduceState(nextEvent);
+        const auto ev = newEvent(itSim.first);
+        if (ev == D_EVENT_FAILED_RET) continue;  // eg new ev when frozen
+
+        setEvs_.emplace_back(ev, itSim.second);
+        trace(itSim.second ? TraceRing::SET_TRUE : TraceRing::SET_FALSE, ev);
+        pureSetState(ev, itSim.second);
     }
+    trace(TraceRing::SET_END, aSimuEvents.size());
+    const auto base = candEvs_.size();
+    for (auto idx = setEvs_.size(); idx > setBase; --idx)  // reverse for LIFO
+        pushNext(setEvs_[idx - 1].first, setEvs_[idx - 1].second, candEvs_);
+    setEvs_.resize(setBase);
+    if (not deduceParallel(base)) deduceState(base);
 
     if (!sthChanged_) DBG("nothing changed for all nEvent=" << aSimuEvents.size());
 }
 
 // ***********************************************************************************************
-Domino::EvName Domino::whyFalse(const EvName& aEvName) const
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::setPrev(const EvNameView aEvName,
+    const SimuEvents& aSimuPrevEvents)
 {
-    auto&& ev = getEventBy(aEvName);
+    return purePrev(newEvent(aEvName), aSimuPrevEvents);
+}
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::setPrev(const EvNameView aEvName,
+    const SimuEvNames aSimuPrevEvents)
+{
+    return purePrev(newEvent(aEvName), aSimuPrevEvents);
+}
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::setPrev(const EventHandle aHdl,
+    const SimuEvNames aSimuPrevEvents)
+{
+    return purePrev(getEventBy(aHdl), aSimuPrevEvents);
+}
 
-    auto&& itPairTrue = prev_[true].find(ev);
-    if (itPairTrue != prev_[true].end())
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::setState(const SimuEvents& aSimuEvents)
+{
+    pureSetStates(aSimuEvents);
+}
+template<class aEvent>
+void BasicDomino<aEvent>::setState(const SimuEvNames aSimuEvents)
+{
+    pureSetStates(aSimuEvents);
+}
+template<class aEvent>
+void BasicDomino<aEvent>::pureSetOne(const Event aEv, const bool aNewState)
+{
+    if (aEv == D_EVENT_FAILED_RET) return;
+    flatten();
+
+    trace(TraceRing::SET_BEGIN, 1);
+    trace(aNewState ? TraceRing::SET_TRUE : TraceRing::SET_FALSE, aEv);
+    pureSetState(aEv, aNewState);
+    trace(TraceRing::SET_END, 1);
+    const auto base = candEvs_.size();
+    pushNext(aEv, aNewState, candEvs_);
+    deduceState(base);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::Event BasicDomino<aEvent>::setNeed(const EvNameView aEvName, const size_t aNeed)
+{
+    const auto event = newEvent(aEvName);
+    if (event == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
+    const auto nPrev = topo_->prev_.degree(event);
+    if (frozen() || aNeed > nPrev)
+    {
+        WRN("!!!Failed, can't setNeed(" << aNeed << ") of EvName=" << aEvName << " (frozen or > nPrev=" << nPrev
+            << ")");
+        return D_EVENT_FAILED_RET;
+    }
+    if (topo_->need_[event] == aNeed) return event;  // incl no prev (need 0 only): nothing to re-deduce
+
+    journalTopo();
+    editTopo().need_[event] = Event(aNeed);
+    HID("Succeed, EvName=" << aEvName << ", need=" << aNeed << ", nPrev=" << nPrev);
+    if (retract_ && states_[event] && not enough(event, nUnsatPrev_[event])) fallEvs_.push_back(event);
+    const auto base = candEvs_.size();
+    candEvs_.push_back(event);
+    deduceState(base);
+    return event;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::rmEvent(const EvNameView aEvName)
+{
+    const auto event = getEventBy(aEvName);
+    if (event == D_EVENT_FAILED_RET || frozen() || nDeducing_ > 0 || mounts_.up_.count(event)
+        || mounts_.down_.count(event))
+    {
+        WRN("!!!Failed, can't rm EvName=" << aEvName << " (not exist, frozen, mounted or in broadcast)");
+        return false;
+    }
+
+    forget(event);  // extensions 1st, while EvName still valid
+    journalTopo();
+    auto&& topo = editTopo();
+    for (size_t idx = 0, nPrev = topo.prev_.degree(event); idx < nPrev; ++idx)
+    {
+        auto&& prevEdge = topo.prev_.at(event, idx);
+        topo.next_.rm(EdgeCsr::nodeOf(prevEdge), EdgeCsr::toEdge(event, EdgeCsr::flagOf(prevEdge)));
+    }
+    topo.prev_.clear(event);
+
+    std::vector<Event> nexts;
+    for (size_t idx = 0, nNext = topo.next_.degree(event); idx < nNext; ++idx)
+    {
+        auto&& nextEdge = topo.next_.at(event, idx);
+        const auto nextEv = EdgeCsr::nodeOf(nextEdge);
+        topo.prev_.rm(nextEv, EdgeCsr::toEdge(event, EdgeCsr::flagOf(nextEdge)));
+        if (states_[event] != EdgeCsr::flagOf(nextEdge)) --nUnsatPrev_[nextEv];
+        if (retract_ && states_[nextEv] && not enough(nextEv, nUnsatPrev_[nextEv])) fallEvs_.push_back(nextEv);
+        nexts.push_back(nextEv);
+    }
+    topo.next_.clear(event);
+
+    if (topo.compUp_[event] == event && topo.compSize_[event] == 1) --topo.nComp_;
+    topo.need_[event] = 0;
+    states_[event] = false;
+    nUnsatPrev_[event] = 0;
+    firedEpoch_[event] = 0;
+    journal_.done_.erase(event);
+    ++rmGen_[event];  // refuse its EventHandles after reuse
+    topo.evNames_.rm(event);
+    HID("Succeed, EvName=" << aEvName << ", event id=" << event << " to reuse, nNext=" << nexts.size());
+
+    candEvs_.assign(nexts.rbegin(), nexts.rend());  // reverse for LIFO
+    deduceState(0);
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::reserve(const size_t aNEvent, const size_t aNEdge)
+{
+    auto&& topo = editTopo();
+    topo.evNames_.reserve(aNEvent, 0);
+    topo.prev_.reserve(aNEvent, aNEdge);
+    topo.next_.reserve(aNEvent, aNEdge);
+    for (auto&& vec : {&topo.need_, &topo.ord_, &topo.evOfOrd_, &topo.compUp_, &topo.compSize_, &nUnsatPrev_})
+        vec->reserve(aNEvent);
+    states_.reserve(aNEvent);
+    firedEpoch_.reserve(aNEvent);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::save(const std::string& aPath) const
+{
+    if (nRemoved() > 0)
     {
-        for (auto&& candEv : itPairTrue->second)
+        WRN("!!!Failed, can't save since nRemoved=" << nRemoved() << " (compact() 1st)");
+        return false;
+    }
+
+    DominoSnapshot snap;
+    auto&& tagOf = DominoSnapshot::tagOf;
+    topo_->evNames_.save(snap);
+    topo_->prev_.save(snap, tagOf("prvR"), tagOf("prvE"));
+    topo_->next_.save(snap, tagOf("nxtR"), tagOf("nxtE"));
+    snap.put(tagOf("need"), topo_->need_);
+    snap.put(tagOf("ordr"), topo_->evOfOrd_);
+    snap.put(tagOf("cpUp"), topo_->compUp_);
+    snap.put(tagOf("cpSz"), topo_->compSize_);
+    snap.put(tagOf("nCmp"), std::vector<uint64_t>{topo_->nComp_});
+    snap.put(tagOf("frzn"), std::vector<bool>{topo_->frozen_});
+    snap.put(tagOf("stat"), states_);
+    snap.put(tagOf("nUns"), nUnsatPrev_);
+    saveExt(snap);
+    if (not snap.save(aPath, sizeof(Event)))
+    {
+        WRN("!!!Failed to write snapshot=" << aPath);
+        return false;
+    }
+    HID("Succeed, snapshot=" << aPath << ", nEvent=" << nEvent() << ", frozen=" << frozen());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::setRetract(const bool aRetract)
+{
+    retract_ = aRetract;
+    HID("retract=" << retract_);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::setParallel(const size_t aNThread, const size_t aMinCand)
+{
+    nThread_ = aNThread;
+    minCand_ = aMinCand;
+    if (nThread_ > 1) pool_.workers_ = std::make_unique<WorkerPool>(nThread_ - 1);
+    else pool_.workers_.reset();
+    HID("nThread=" << nThread_ << ", minCand=" << minCand_);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::shareTopo(const BasicDomino& aFrom)
+{
+    if (nEvent() > 0)
+    {
+        WRN("!!!Failed, can't share topology since already has nEvent=" << nEvent());
+        return false;
+    }
+    journalTopo();
+    topo_ = aFrom.topo_;
+    states_ = aFrom.states_;
+    nUnsatPrev_ = aFrom.nUnsatPrev_;
+    firedEpoch_.assign(nEvent(), 0);
+    shareExt(aFrom);
+    HID("Succeed, share topology of " << aFrom.log_.prefix_ << ", nEvent=" << nEvent());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDomino<aEvent>::takeDone(const Event aEv)
+{
+    if (journal_.done_.empty()) return false;  // most
+    const auto it = journal_.done_.find(aEv);
+    if (it == journal_.done_.end()) return false;
+
+    if (--it->second == 0) journal_.done_.erase(it);
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicDomino<aEvent>::thaw()
+{
+    if (not frozen()) return;
+
+    auto&& topo = editTopo();
+    topo.evNames_.thaw();
+    topo.frozen_ = false;
+    HID("Succeed, nEvent=" << nEvent());
+}
+
+// ***********************************************************************************************
+// - Pearce-Kelly: only events between aNext & aPrev in ord_ are visited & re-ordered, so
+//   setPrev() is sub-linear (vs Kahn O(nEvent + nEdge) per check)
+// - aPrev's (indirect) prevs in region move before aNext's (indirect) nexts, reusing their slots
+template<class aEvent>
+void BasicDomino<aEvent>::reorder(const Event aPrev, const Event aNext)
+{
+    auto&& topo = editTopo();
+    std::vector<Event> fwd;  // aNext & its nexts, ord_ <= aPrev's
+    std::vector<Event> bwd;  // aPrev & its prevs, ord_ >= aNext's
+    reachInOrder(aNext, true, topo.ord_[aPrev], fwd, D_EVENT_FAILED_RET);
+    reachInOrder(aPrev, false, topo.ord_[aNext], bwd, D_EVENT_FAILED_RET);
+
+    const auto byOrd = [&topo](const Event aLeft, const Event aRight) { return topo.ord_[aLeft] < topo.ord_[aRight]; };
+    std::sort(fwd.begin(), fwd.end(), byOrd);
+    std::sort(bwd.begin(), bwd.end(), byOrd);
+    std::vector<Event> slots;
+    slots.reserve(fwd.size() + bwd.size());
+    for (auto&& ev : bwd) slots.push_back(topo.ord_[ev]);
+    for (auto&& ev : fwd) slots.push_back(topo.ord_[ev]);
+    std::sort(slots.begin(), slots.end());
+
+    size_t idx = 0;
+    for (auto&& evs : {&bwd, &fwd})
+    {
+        for (auto&& ev : *evs)
         {
-            if (states_[candEv] == false) return evNames_[candEv] + "==false";
+            topo.ord_[ev] = slots[idx++];
+            topo.evOfOrd_[topo.ord_[ev]] = ev;
         }
     }
+}
 
-    auto&& itPairFalse = prev_[false].find(ev);
-    if (itPairFalse != prev_[false].end())
+// ***********************************************************************************************
+// DFS from aFrom along next_ (aFwd) or prev_, only within ord_ <= aBound (aFwd) or >= aBound;
+// ret true (& stop) if reach aStop
+template<class aEvent>
+bool BasicDomino<aEvent>::reachInOrder(const Event aFrom, const bool aFwd, const Event aBound,
+    std::vector<Event>& aReached, const Event aStop) const
+{
+    auto&& edges = aFwd ? topo_->next_ : topo_->prev_;
+    std::unordered_set<Event> visited{aFrom};
+    std::vector<Event> stack{aFrom};
+    while (not stack.empty())
     {
-        for (auto&& candEv : itPairFalse->second)
+        const auto ev = stack.back();
+        stack.pop_back();
+        if (ev == aStop) return true;
+        aReached.push_back(ev);
+
+        for (size_t idx = 0, nEdge = edges.degree(ev); idx < nEdge; ++idx)
         {
-            if (states_[candEv] == true) return evNames_[candEv] + "==true";
+            const auto adjEv = EdgeCsr::nodeOf(edges.at(ev, idx));
+            const auto ord = topo_->ord_[adjEv];
+            if ((aFwd ? ord > aBound : ord < aBound) || not visited.insert(adjEv).second) continue;
+            stack.push_back(adjEv);
         }
     }
+    return false;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+std::vector<typename BasicDomino<aEvent>::Event> BasicDomino<aEvent>::topoOrder() const
+{
+    return topo_->evOfOrd_;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicDomino<aEvent>::EvName BasicDomino<aEvent>::whyFalse(const Event aEv) const
+{
+    if (aEv == D_EVENT_FAILED_RET || enough(aEv, nUnsatPrev_[aEv])) return EvName();  // no scan
 
+    for (size_t idx = 0, nPrev = topo_->prev_.degree(aEv); idx < nPrev; ++idx)
+    {
+        auto&& prevEdge = topo_->prev_.at(aEv, idx);
+        auto&& prevEv = EdgeCsr::nodeOf(prevEdge);
+        if (states_[prevEv] == EdgeCsr::flagOf(prevEdge)) continue;
+        return EvName(evName(prevEv)) + (EdgeCsr::flagOf(prevEdge) ? "==false" : "==true");
+    }
     return EvName();
 }
+
+// ***********************************************************************************************
+template class BasicDomino<uint16_t>;
+template class BasicDomino<uint32_t>;
+template class BasicDomino<size_t>;
+
+// DominoReplay's steps
+template void BasicDomino<uint16_t>::pureSetStates(const std::vector<BasicDomino<uint16_t>::SimuEvName>&);
+template void BasicDomino<uint32_t>::pureSetStates(const std::vector<BasicDomino<uint32_t>::SimuEvName>&);
+template void BasicDomino<size_t>::pureSetStates(const std::vector<BasicDomino<size_t>::SimuEvName>&);
 }  // namespace
@@ -23,7 +23,7 @@
 // - assmuption:
 //   . each event-hdlr is called only when event state F->T
 //   . repeated event/hdlr is complex, be careful(eg DominoTests.newTriggerViaChain)
-//   . dead-loop: complex so not code check but may tool check (eg excel)
+//   . dead-loop: setPrev() refuses (incrementally kept topological order)
 // - core: states_
 // - VALUE:
 //   * auto broadcast, auto callback, auto shape [MUST-HAVE!]
@@ -34,29 +34,74 @@
 #ifndef DOMINO_HPP_
 #define DOMINO_HPP_
 
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iosfwd>  // istream
+#include <limits>
 #include <map>
+#include <memory>  // shared_ptr
 #include <set>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>  // pair
 #include <vector>
 
 #include "CppLog.hpp"
+#include "DominoJournal.hpp"
+#include "DominoSnapshot.hpp"
+#include "EdgeCsr.hpp"
+#include "EvNameStore.hpp"
+#include "HashedEvName.hpp"
+#include "TraceRing.hpp"
+#include "WorkerPool.hpp"
 
 namespace RLib
 {
+template<class aEvent> class BasicSlicedDomino;
+template<class aEvent> class BasicWhatIf;
+template<class aEvent> class BasicDominoReplay;
+template<class aEvent> class BasicCritPath;
+
 // ***********************************************************************************************
-class Domino
+// aEvent: smaller size (eg uint16_t) can save mem; larger size (eg size_t) can support more events
+template<class aEvent>
+class BasicDomino
 {
 public:
-    using Event      = size_t;  // smaller size can save mem; larger size can support more events
+    using Event      = aEvent;
     using Events     = std::set<Event>;
     using EvName     = std::string;
     using SimuEvents = std::map<EvName, bool>;  // not unordered-map since most traversal
 
-    enum
+    using EvNameView  = std::string_view;                      // search EvName w/o alloc
+    using SimuEvName  = std::pair<EvNameView, bool>;
+    using SimuEvNames = std::initializer_list<SimuEvName>;     // = SimuEvents w/o alloc
+
+    enum { N_EVENT_STATE = 2 };
+    static constexpr Event D_EVENT_FAILED_RET = std::numeric_limits<Event>::max();
+    static constexpr Event MAX_EVENT = D_EVENT_FAILED_RET >> 1;  // 1 bit for edge polarity (EdgeCsr)
+
+    // -------------------------------------------------------------------------------------------
+    // - pre-resolved Event for hot path (eg periodic hdlr): no EvName hash per call
+    // - safer than raw Event: only Domino can create it, & Domino refuses other Domino's handle, or
+    //   handle of a removed event even after its Event is reused (see rmEvent())
+    // -------------------------------------------------------------------------------------------
+    class EventHandle
     {
-        N_EVENT_STATE      = 2,
-        D_EVENT_FAILED_RET = static_cast<size_t>(-1),
+    public:
+        EventHandle() = default;  // invalid handle
+        Event event() const { return ev_; }
+
+    private:
+        friend class BasicDomino;
+        EventHandle(const size_t aDmnID, const Event aEv, const uint32_t aGen) : dmnID_(aDmnID), ev_(aEv), gen_(aGen)
+        {}
+
+        size_t   dmnID_ = static_cast<size_t>(-1);  // which Domino
+        Event    ev_    = D_EVENT_FAILED_RET;
+        uint32_t gen_   = 0;                        // rmGen(ev_) when created
     };
 
     // -------------------------------------------------------------------------------------------
@@ -66,46 +111,372 @@ public:
     // - state:  tile's up/down state, mandatory, default=false
     // - prev:   prev tile(s)        , optional
     // -------------------------------------------------------------------------------------------
-    Domino() : log_("Dmn-" + std::to_string(dmnID_++)) {}
-    virtual ~Domino() = default;
+    BasicDomino() : id_(dmnID_++), log_("Dmn-" + std::to_string(id_)) {}
+    virtual ~BasicDomino();  // unmount from parents & children
 
-    Event newEvent(const EvName&);
-    Event getEventBy(const EvName&) const;
+    Event newEvent(const EvNameView aEvName) { return newEvent(HashedEvName(aEvName)); }
+    Event newEvent(const HashedEvName&);  // eg newEvent("a"_ev): hash at compile time
+    Event getEventBy(const EvNameView aEvName) const { return getEventBy(HashedEvName(aEvName)); }
+    Event getEventBy(const HashedEvName&) const;
+    EventHandle newHandle(const EvNameView aEvName) { return newHandle(HashedEvName(aEvName)); }
+    EventHandle newHandle(const HashedEvName& aEvName)
+    {
+        const auto event = newEvent(aEvName);
+        return EventHandle(id_, event, rmGen(event));
+    }
+    Event getEventBy(const EventHandle) const;  // D_EVENT_FAILED_RET if not this Domino's
 
-    bool   state(const EvName& aEvName) const { return state(getEventBy(aEvName)); }
+    bool   state(const EvNameView aEvName) const { return state(getEventBy(aEvName)); }
+    bool   state(const EventHandle aHdl) const { return state(getEventBy(aHdl)); }
+    bool   state(const HashedEvName& aEvName) const { return state(getEventBy(aEvName)); }
     void   setState(const SimuEvents&);
-    Event  setPrev(const EvName&, const SimuEvents& aSimuPrevEvents);
-    EvName whyFalse(const EvName&) const;
+    void   setState(const SimuEvNames);  // eg setState({{"a", true}}) w/o heap alloc; same ev: last win
+    void   setState(const EvNameView aEvName, const bool aNewState) { setState({{aEvName, aNewState}}); }
+    void   setState(const EventHandle aHdl, const bool aNewState) { pureSetOne(getEventBy(aHdl), aNewState); }
+    void   setState(const HashedEvName& aEvName, const bool aNewState) { pureSetOne(newEvent(aEvName), aNewState); }
+    Event  setPrev(const EvNameView, const SimuEvents& aSimuPrevEvents);
+    Event  setPrev(const EvNameView, const SimuEvNames aSimuPrevEvents);
+    Event  setPrev(const EventHandle, const SimuEvNames aSimuPrevEvents);
+    EvName whyFalse(const EvNameView aEvName) const { return whyFalse(getEventBy(aEvName)); }
+    EvName whyFalse(const EventHandle aHdl) const { return whyFalse(getEventBy(aHdl)); }
+
+    // -------------------------------------------------------------------------------------------
+    // - k-of-n tile: deduced true when >= aNeed of its prevs satisfied, eg 1 = OR ("any link up"),
+    //   3 ("3 of 5 paths ready"); 0 = all (AND, default)
+    //   . same nUnsatPrev_ counter as AND, so 1 event instead of alias events (multiHdlrByAliasEv)
+    //   . part of topology (refused when frozen); whyFalse() rets 1 of its unsatisfied prevs
+    //   . setPrev() 1st: aNeed > nPrev is refused (never true); rmEvent() of a prev may leave it so
+    //   . re-deduce only when aNeed changed, so event w/o prev keeps its state
+    // -------------------------------------------------------------------------------------------
+    Event  setNeed(const EvNameView, const size_t aNeed);
+
+    // -------------------------------------------------------------------------------------------
+    // - freeze: after setup (graph fixed, only state changes), faster setState() & lookup
+    //   . EvName index -> perfect hash + 1 str arena; edges -> contiguous in topological order
+    //   . refuse setPrev() & new event till thaw()
+    // -------------------------------------------------------------------------------------------
+    void freeze();
+    void thaw();
+    bool frozen() const { return topo_->frozen_; }
+
+    // -------------------------------------------------------------------------------------------
+    // - share topology (EvNames, edges, & extensions' eg priorities) of aFrom, eg 1 template for
+    //   1000s radio units: per instance only states_ & counters (+ hdlrs/data of extensions)
+    // - only empty Domino can share; starts w/ aFrom's states
+    // - any later setPrev()/new event/freeze() on either side copies topology 1st (copy-on-write),
+    //   so better freeze() the template before share
+    // -------------------------------------------------------------------------------------------
+    bool shareTopo(const BasicDomino& aFrom);
+    bool sharedTopo() const { return topo_.use_count() > 1; }
+
+    // -------------------------------------------------------------------------------------------
+    // - parallel: setState() of many events deduces each connected component (events linked by
+    //   setPrev(), tracked incrementally) on its own thread, then calls effect() (eg trigger hdlr)
+    //   on caller's thread in the same order as serial
+    //   . only when >= aMinCand candidates over >= 2 components, else serial: waking the workers
+    //     costs ~15us per batch vs ~0.4us serial per candidate of a short chain (ParallelBench)
+    //   . workers are created here & kept till destructed (or setParallel() again)
+    //   . effect() is deferred till all components deduced, so hdlr shall not setState()/setPrev()
+    //     synchronously (true w/ MsgSelf, which runs hdlr in its own loop)
+    // -------------------------------------------------------------------------------------------
+    enum : size_t { DEF_MIN_CAND = 256 };
+    void   setParallel(const size_t aNThread, const size_t aMinCand = DEF_MIN_CAND);  // aNThread <= 1: serial (default)
+
+    // -------------------------------------------------------------------------------------------
+    // - retract: true event (tile w/ prev) whose prevs become unsatisfied falls back to false, &
+    //   so on along next_ (eg rollback/retry: reset inputs only, derived tiles follow)
+    //   . incremental via nUnsatPrev_: cost ~ affected edges
+    //   . falling is not effect() (hdlr only on F->T), but re-satisfied tile fires (& calls hdlr) again
+    //   . default off (legacy: derived tile stays true); setParallel() not applied when on
+    // -------------------------------------------------------------------------------------------
+    void setRetract(const bool aRetract);
+    bool retract() const { return retract_; }
+
+    // -------------------------------------------------------------------------------------------
+    // - mount: aChild (eg RU/BBU/transport module, built & frozen independently) becomes 1 tile
+    //   aTile here: aTile follows aChild's aChildEv (eg "done"), T & F, & ripples on here
+    //   . ripple inside aChild stays in aChild, so this (parent) stays small & cache-resident
+    //   . 1 aChildEv to 1 aTile; aTile is an input here (better no own prev)
+    //   . links are per instance: not copied w/ Domino, auto unmounted when either side destructs
+    // -------------------------------------------------------------------------------------------
+    Event mount(const EvNameView aTile, BasicDomino& aChild, const EvNameView aChildEv);
+    bool  unmount(const EvNameView aTile);
+    size_t nComponent() const { return topo_->nComp_; }
+
+    // -------------------------------------------------------------------------------------------
+    // - rmEvent: rm 1 event (eg per-session tile of a done job) & its edges, & extensions' data of
+    //   it (hdlr, priority, data, etc); its nexts re-deduce w/o it
+    //   . its Event is reused by next new event; its old EventHandle is refused (not alias the new one)
+    //   . refused when frozen, mounted, or in broadcast (eg hdlr called synchronously)
+    //   . its component is not split (setParallel() just coarser) till compact()
+    // - compact: renumber events densely & repack topology, states & extensions to return mem of
+    //   removed events (eg periodically); all EventHandles become invalid (get new by newHandle())
+    //   . better when no hdlr on road (eg FreeHdlrDomino's on-road hdlr keeps old Event)
+    //   . freeze() compacts 1st if any removed
+    //   . no-op if nothing removed (eg shared topology stays shared)
+    // -------------------------------------------------------------------------------------------
+    bool rmEvent(const EvNameView);
+    bool compact();
+
+    // -------------------------------------------------------------------------------------------
+    // - snapshot: save() topology & states (+ extensions' priority, repeat flag, write-ctrl) into 1
+    //   binary file (see DominoSnapshot); load() into an empty Domino by mmap & bulk copy instead of
+    //   1000s newEvent()/setPrev()/etc, eg warm restart ready in ms
+    //   . frozen Domino loads fastest (perfect hash as is, no EvName index rebuild)
+    //   . not saved: hdlr & data (code/pointer, set again after load), mounts, setRetract()/setParallel()
+    //   . refused: save() w/ removed event (compact() 1st); load() of other Event width/version, or
+    //     corrupted, eg bad range/order/counter (false: discard this Domino, extension may be half loaded)
+    // -------------------------------------------------------------------------------------------
+    bool save(const std::string& aPath) const;
+    bool load(const std::string& aPath);
+
+    // -------------------------------------------------------------------------------------------
+    // - bulk build: loadGraph() a whole graph into an empty Domino in 1 pass, eg 1M edges from a
+    //   generated/exported description, instead of newEvent()/setPrev() per edge (EvName lookups,
+    //   dup & dead-loop check, reorder, overflow per edge)
+    //   . each EvName hashed once; edges by index (no lookup), into CSR by counting sort; dead-loop
+    //     check & topological order by 1 pass; then states settled in that order by 1 pass
+    //   . = newEvent() per aEvNames in order (Event = index) + setPrev() per event (prev before next)
+    //     w/ all its prevs (each event's edges in aEdges' order); only topological order may differ
+    //   . refused (nothing changed): not empty, dup EvName, edge index out of range/self/dup, dead-loop
+    // - text: 1st line "nEvent nEdge", then nEvent lines of EvName (Event = line order), then nEdge
+    //   lines of "prev next prevState(0/1)"; empty & '#' lines are skipped (so no such EvName)
+    // - binary: save()/load() above
+    // - reserve(): pre-size per-event & topology mem, eg before many newEvent()/setPrev()
+    // -------------------------------------------------------------------------------------------
+    struct GraphEdge
+    {
+        size_t prev;
+        size_t next;
+        bool   prevState;  // prev's state to satisfy next
+    };
+    bool loadGraph(const std::vector<EvNameView>& aEvNames, const std::vector<GraphEdge>& aEdges);
+    bool loadGraph(std::istream& aText);
+    void reserve(const size_t aNEvent, const size_t aNEdge);
+
+    // -------------------------------------------------------------------------------------------
+    // - journal: append each state change (set or deduced) into aPath (see DominoJournal), so crash
+    //   (eg mid-upgrade) keeps which tiles were true, w/o re-running completed hdlrs
+    //   . group commit: 1 write + fdatasync per aBatch broadcasts (setState()/setPrev()/etc); crash
+    //     loses uncommitted ones, so larger aBatch = faster but may lose more
+    //   . HdlrDomino also journals each hdlr done (committed w/ next batch or commitJournal();
+    //     at-least-once: done but uncommitted re-runs after recovery)
+    // - openJournal() on load()ed snapshot (or same build) = recovery: replay committed records w/o
+    //   effect() (no hdlr, no mount export), then go on appending; setHdlr() on true event won't
+    //   re-trigger its completed hdlr (MultiHdlrDomino: by count)
+    // - checkpoint(): save() then empty the journal, eg periodically & after topology change (new
+    //   event, setPrev(), setNeed(), rmEvent(), compact(), etc are not journaled: journal of other
+    //   topology, or w/ any topology change after its last checkpoint(), is refused by recovery)
+    // - not journaled: extension data (eg replaceShared(), type-erased), setRetract()/setParallel()
+    // -------------------------------------------------------------------------------------------
+    bool openJournal(const std::string& aPath, const size_t aBatch = 1);
+    bool checkpoint(const std::string& aSnapshotPath);
+    bool commitJournal();
+    void closeJournal();
 
     // -------------------------------------------------------------------------------------------
     // misc:
-    size_t nEvent() const { return states_.size(); }
+    size_t nEvent() const { return states_.size(); }  // incl. removed till reused/compact()
+    size_t nRemoved() const { return topo_->evNames_.nFree(); }
+    size_t nHashCollision() const { return topo_->evNames_.nCollision(); }  // EvNames share hash w/ other
+
+    struct MemFootprint  // approximate bytes, eg to check big Domino's resident mem
+    {                      // evNames_/evIndex_/edges_ are topology, shared if sharedTopo()
+        size_t evNames_  = 0;  // EvName strs (arena) + [event]=view
+        size_t evIndex_  = 0;  // [evName]=event
+        size_t edges_    = 0;  // prev_ + next_ + need_ + components + topological order
+        size_t perEvent_ = 0;  // states_, counters, etc
+
+        size_t total() const { return evNames_ + evIndex_ + edges_ + perEvent_; }
+    };
+    MemFootprint memFootprint() const;
 
 protected:
-    const EvName& evName(const Event aEv) const { return evNames_[aEv]; }  // aEv must valid
+    EvNameView evName(const Event aEv) const { return topo_->evNames_.name(aEv); }  // aEv must valid
     bool state(const Event aEv) const { return aEv < states_.size() ? states_[aEv] : false; }
     virtual void effect(const Event) {}
+    virtual bool hasEffect(const Event) const { return false; }  // would effect() do sth (eg call hdlr)
+
+    // extension's per-event data: drop by rmEvent(), & renumber by compact() ([old]=new event or
+    // D_EVENT_FAILED_RET if removed); override shall call aDominoType's
+    virtual void forget(const Event) {}
+    virtual void renumber(const std::vector<Event>&) {}
+    template<class aMapType> static void renumberKeys(aMapType&, const std::vector<Event>& aNewOf);  // [event]=data
+    template<class aVecType> static void renumberVec(aVecType&, const std::vector<Event>& aNewOf);   // [event]=data
+
+    // extension's own sections of save()/load(), absent section = default; override shall call aDominoType's
+    virtual void saveExt(DominoSnapshot&) const {}
+    virtual bool loadExt(const DominoSnapshot&, const size_t /*aNEvent*/) { return true; }  // false if bad
+
+    // extension's shared topology part (eg priorities) by shareTopo(); aFrom may lack this extension (keep
+    // own then); override shall call aDominoType's
+    virtual void shareExt(const BasicDomino& /*aFrom*/) {}
+
+    // see TraceRing
+    void trace(const TraceRing::Kind aKind, const uint64_t aId) const { TraceRing::record(aKind, aId, traceSrc()); }
+    uint32_t traceSrc() const { return uint32_t(id_); }  // eg for record() w/o this (on-road hdlr)
+
+    // extension's hdlr done, see openJournal()
+    bool journaled() const { return journal_.file_ != nullptr; }
+    std::function<void()> doneNote(const Event) const;  // to call after hdlr done: into journal if still open
+    bool takeDone(const Event);  // consume 1 hdlr done before recovery of this true event, if any
 
 private:
-    void deduceState(const Event);
+    using OrderedEvs = std::vector<std::pair<size_t, Event> >;  // (serial order, event)
+
+    void deduceState(const size_t aBase);
+    bool deduceParallel(const size_t aBase);  // false: not worth, nothing done
+    void deduceAlone(const OrderedEvs& aCands, const size_t aEpoch, OrderedEvs& aFired);  // in worker thread
+    void pushNext(const Event, const bool aState, std::vector<Event>& aCandEvs) const;  // reverse for LIFO
+    void countUnsat(const Event, const bool aNewState);  // update next_'s nUnsatPrev_ (& fallEvs_)
+    void exportState(const Event, const bool aNewState);  // to parent's tile if mounted
+    bool enough(const Event aEv, const Event aNUnsat) const  // satisfied (see setNeed())
+    {
+        const auto need = topo_->need_[aEv];
+        return need == 0 ? aNUnsat == 0 : topo_->prev_.degree(aEv) - aNUnsat >= need;
+    }
     void pureSetState(const Event, const bool aNewState);
+    void journalState(const Event, const bool aNewState);
+    void journalBatch(const size_t aBase) { if (aBase == 0 && journal_.file_) journal_.file_->endBatch(); }
+    void journalTopo() { if (journal_.file_) journal_.file_->topoChanged(); }
+    uint64_t topoHash() const;  // fingerprint of EvNames, edges & need_ (see DominoJournal)
+    void flatten();  // compact() edges added since last broadcast, if not nested nor shared
+    void pureSetOne(const Event, const bool aNewState);  // setState() + broadcast of 1 ev
+    template<class aSimuEvs> void  pureSetStates(const aSimuEvs&);
+    template<class aSimuEvs> Event purePrev(const Event, const aSimuEvs&);
+    EvName whyFalse(const Event) const;
+    std::vector<Event> topoOrder() const;  // = evOfOrd_
+    void reorder(const Event aPrev, const Event aNext);  // keep ord_ after edge aPrev->aNext added
+    bool reachInOrder(const Event aFrom, const bool aFwd, const Event aBound, std::vector<Event>& aReached,
+        const Event aStop) const;
 
     // -------------------------------------------------------------------------------------------
     std::vector<bool> states_;                     // bitmap & dyn expand, [event]=t/f
+    std::vector<Event> nUnsatPrev_;                // [event]=num of prev not satisfied, see enough()
+                                                   // (<= 2 * (nEvent - 1) so fits Event)
+    std::vector<size_t> firedEpoch_;               // [event]=epoch_ when fired, so fire once per deduceState()
+    size_t epoch_ = 0;                             // inc per deduceState()
+    std::vector<Event> candEvs_;                   // deduceState()'s worklist, reuse mem
+    std::vector<std::pair<Event, bool> > setEvs_;  // setState()'s accepted inputs, reuse mem
+    std::vector<Event> fallEvs_;                   // to retract (setRetract())
+    size_t nDeducing_ = 0;                         // > 0 while deduceState() or effect() on stack (eg sync
+                                                   // hdlr), so rmEvent()/compact() refused
+    bool retract_ = false;
+    std::unordered_map<Event, uint32_t> rmGen_;    // [event]=times removed by rmEvent(), absent=0; cleared
+                                                   // by compact() (new id_)
+    uint32_t rmGen(const Event aEv) const
+    {
+        if (rmGen_.empty()) return 0;  // most
+        const auto it = rmGen_.find(aEv);
+        return it == rmGen_.end() ? 0 : it->second;
+    }
 
-    std::map<Event, Events> prev_[N_EVENT_STATE];  // not unordered-map since most traversal
-    std::map<Event, Events> next_[N_EVENT_STATE];  // not unordered-map since most traversal
-    std::unordered_map<EvName, Event> events_;     // [evName]=event
-    std::vector<EvName> evNames_;                  // [event]=evName for easy debug
+    struct Link
+    {
+        BasicDomino* dom_;
+        Event ev_;
+    };
+    struct Mounts  // see mount(); links are to this instance, so not copied
+    {
+        std::unordered_map<Event, Link> up_;    // [my ev]=parent's tile
+        std::unordered_map<Event, Link> down_;  // [my tile]=child's ev
+
+        Mounts() = default;
+        Mounts(const Mounts&) {}
+        Mounts& operator=(const Mounts&) { return *this; }
+    };
+    Mounts mounts_;
+    struct Journal  // see openJournal(); per instance, so not copied
+    {
+        std::shared_ptr<DominoJournal> file_;
+        std::unordered_map<Event, size_t> done_;  // [true event]=num of hdlr done before recovery
+
+        Journal() = default;
+        Journal(const Journal&) {}
+        Journal& operator=(const Journal&) { return *this; }
+    };
+    Journal journal_;
     bool sthChanged_ = false;                      // for debug
+    size_t nThread_ = 1;                           // see setParallel()
+    size_t minCand_ = DEF_MIN_CAND;
+    struct Pool  // see setParallel(); threads per instance, so not copied (created again on need)
+    {
+        std::unique_ptr<WorkerPool> workers_;  // nThread_ - 1, caller's thread is the 1st
+
+        Pool() = default;
+        Pool(const Pool&) {}
+        Pool& operator=(const Pool&) { return *this; }
+    };
+    Pool pool_;
+    size_t id_;                                    // for EventHandle, new per compact()
+
+    using EdgeCsr = BasicEdgeCsr<Event>;
+    struct Topo  // immutable while shared (see shareTopo())
+    {
+        EdgeCsr prev_;         // [event]=prev edges(prevEv, prevEv's state)
+        EdgeCsr next_;         // [event]=next edges(nextEv, this ev's state)
+        EvNameStore evNames_;  // [event]=evName & [evName]=event
+        bool frozen_ = false;  // see freeze()
+
+        std::vector<Event> need_;      // [event]=num of satisfied prev to deduce true, 0=all (see setNeed())
+        std::vector<Event> ord_;       // [event]=index in topological order (prev before next)
+        std::vector<Event> evOfOrd_;   // [index]=event, inverse of ord_
+        std::vector<Event> compUp_;    // [event]=parent in union-find of connected components, root=self
+        std::vector<Event> compSize_;  // [root]=num of events; union by size so compOf() is O(log nEvent)
+        size_t nComp_ = 0;
+    };
+    Topo& editTopo();  // copy 1st if shared
+    static Event nUnsatOf(const Event, const Topo&, const std::vector<bool>& aStates);  // recount nUnsatPrev_
+    Event compOf(Event) const;
+    void  joinComp(const Event, const Event);
+    std::shared_ptr<Topo> topo_ = std::make_shared<Topo>();
 
     static size_t dmnID_;
     static const EvName invalidEvName;
 
+    friend class BasicSlicedDomino<aEvent>;  // snapshot topology & states
+    friend class BasicWhatIf<aEvent>;        // read-only overlay
+    friend class BasicDominoReplay<aEvent>;  // feed recorded setState() inputs
+    friend class BasicCritPath<aEvent>;      // read-only prev_
+
 public:  // no impact self but convient non-member-func eg getValue() for DataDomino
     CppLog log_;
 };
 
+// ***********************************************************************************************
+template<class aEvent>
+template<class aMapType>
+void BasicDomino<aEvent>::renumberKeys(aMapType& aMap, const std::vector<Event>& aNewOf)
+{
+    aMapType renumbered;
+    renumbered.reserve(aMap.size());
+    for (auto&& it : aMap)
+        if (aNewOf[it.first] != D_EVENT_FAILED_RET) renumbered.emplace(aNewOf[it.first], std::move(it.second));
+    aMap.swap(renumbered);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+template<class aVecType>
+void BasicDomino<aEvent>::renumberVec(aVecType& aVec, const std::vector<Event>& aNewOf)
+{
+    aVecType renumbered;
+    for (size_t ev = 0; ev < aVec.size(); ++ev)
+    {
+        if (aNewOf[ev] == D_EVENT_FAILED_RET) continue;
+        renumbered.resize(aNewOf[ev] + 1);
+        renumbered[aNewOf[ev]] = aVec[ev];
+    }
+    aVec.swap(renumbered);
+}
+
+using Domino   = BasicDomino<size_t>;
+using Domino32 = BasicDomino<uint32_t>;  // max 2^31 events, eg mid-size graph
+using Domino16 = BasicDomino<uint16_t>;  // max 2^15 events, eg small graph
+
+extern template class BasicDomino<uint16_t>;
+extern template class BasicDomino<uint32_t>;
+extern template class BasicDomino<size_t>;
 }  // namespace
 #endif  // DOMINO_HPP_
 // ***********************************************************************************************
@@ -124,13 +495,17 @@ public:  // no impact self but convient non-member-func eg getValue() for DataDo
 // - why template PriDomino, etc
 //   . easy combine: eg Basic + Pri + Rw or Basic + Rw or Basic + Pri
 //   . direct to get interface of all combined classes (inherit)
+// - why BasicDomino<aEvent>?
+//   . Event width decides edges_/counters/hdlr-map key mem & cache density; mid-size graph need
+//     not pay size_t (Domino16/Domino32)
+//   . derived Dominos take Event etc from aDominoType, so any width combines with any extension
 // - why not separate EvNameDomino from BasicDomino?
 //   . BasicDomino's debug needs EvNameDomino
 // - why not separate SimuDomino from BasicDomino?
 //   . tight couple at setState()
-// - why not rm(event)
-//   . dangeous: may break deduced path
-//   . not must-have req
+// - why rmEvent() only by EvName, & refused when frozen/mounted/in broadcast?
+//   . dangeous: may break deduced path, so its nexts re-deduce right away
+//   . long-running process creates per-session tiles, without rm they grow forever
 // - why Event:EvName=1:1?
 //   . simplify complex scenario eg rmOneHdlrOK() may relate with multi-hdlr
 //   . simplify interface: EvName only, Event is internal-use only
@@ -147,6 +522,7 @@ public:  // no impact self but convient non-member-func eg getValue() for DataDo
 //   . Can buffer last EvName ptr to speedup?
 //     . dangeous: diff func could create EvName at same address in stack
 //     . 021-09-22: all UT, only 41% getEventBy() can benefit by buffer, not worth vs dangeous
+//   . literal EvName (eg "a/b"_ev) is hashed at compile time, lookup = 1 probe (HashedEvName)
 // - how:
 //   *)trigger
 //     . prefer time-cost events
@@ -0,0 +1,164 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <cstring>     // memcmp
+#include <fcntl.h>     // open
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // write
+
+#include "DominoJournal.hpp"
+
+namespace RLib
+{
+constexpr char DominoJournal::MAGIC[8];
+
+// ***********************************************************************************************
+DominoJournal::~DominoJournal()
+{
+    if (fd_ < 0) return;
+    commit();
+    close(fd_);
+}
+
+// ***********************************************************************************************
+void DominoJournal::append(const uint64_t aEv, const Kind aKind)
+{
+    const auto rec = toRecord(aEv, aKind);
+    buf_.push_back(rec);
+    count(rec);
+}
+
+// ***********************************************************************************************
+bool DominoJournal::commit()
+{
+    nBatch_ = 0;
+    if (buf_.empty() || fd_ < 0) return fd_ >= 0;
+
+    buf_.push_back(toRecord(0, COMMIT));
+    const bool ok = writeAll(buf_.data(), buf_.size() * sizeof(Record)) && (not sync_ || fdatasync(fd_) == 0);
+    buf_.clear();
+    nCommit_ += ok;
+    return ok;
+}
+
+// ***********************************************************************************************
+void DominoJournal::count(const Record aRec)
+{
+    switch (kindOf(aRec))
+    {
+    case SET_FALSE:
+    case SET_TRUE:
+        if (not done_.empty()) done_.erase(eventOf(aRec));  // new change, old done not apply
+        break;
+    case HDLR_DONE:
+        ++done_[eventOf(aRec)];
+        break;
+    default:
+        break;
+    }
+}
+
+// ***********************************************************************************************
+bool DominoJournal::open(const std::string& aPath, const uint32_t aEventBytes, const uint64_t aTopo,
+    std::vector<Record>& aRecords)
+{
+    if (fd_ >= 0) return false;
+    const auto fd = ::open(aPath.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    fd_ = fd;
+    eventBytes_ = aEventBytes;
+
+    struct stat st;
+    const auto size = fstat(fd_, &st) == 0 ? size_t(st.st_size) : 0;
+    if (size < sizeof(Header)) return writeHeader(aTopo);  // new, or crashed before header done
+
+    std::vector<char> bytes(size);
+    size_t nRead = 0;
+    while (nRead < size)
+    {
+        const auto n = pread(fd_, bytes.data() + nRead, size - nRead, nRead);
+        if (n <= 0) break;
+        nRead += n;
+    }
+    Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (nRead != size || std::memcmp(header.magic_, MAGIC, sizeof(MAGIC)) || header.version_ != VERSION
+        || header.eventBytes_ != aEventBytes || header.topo_ != aTopo)
+    {
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    const auto nRec = (size - sizeof(Header)) / sizeof(Record);
+    std::vector<Record> recs(nRec);
+    if (nRec) std::memcpy(recs.data(), bytes.data() + sizeof(Header), nRec * sizeof(Record));
+    size_t nCommitted = 0;  // incl. COMMIT
+    for (size_t idx = 0; idx < nRec; ++idx)
+        if (kindOf(recs[idx]) == COMMIT) nCommitted = idx + 1;
+    for (size_t idx = 0; idx < nCommitted; ++idx)
+    {
+        if (kindOf(recs[idx]) != TOPO_CHANGE) continue;
+        close(fd_);
+        fd_ = -1;
+        return false;
+    }
+
+    aRecords.clear();
+    for (size_t idx = 0; idx < nCommitted; ++idx)
+    {
+        if (kindOf(recs[idx]) == COMMIT) continue;
+        aRecords.push_back(recs[idx]);
+        count(recs[idx]);
+    }
+    const auto end = off_t(sizeof(Header) + nCommitted * sizeof(Record));  // cut torn tail
+    return ftruncate(fd_, end) == 0 && lseek(fd_, end, SEEK_SET) == end;
+}
+
+// ***********************************************************************************************
+bool DominoJournal::reset(const uint64_t aTopo)
+{
+    if (fd_ < 0) return false;
+    buf_.clear();
+    nBatch_ = 0;
+    topoChanged_ = false;
+    if (not writeHeader(aTopo)) return false;
+
+    for (auto&& it : done_)  // re-emit, so still known after checkpoint
+        buf_.insert(buf_.end(), it.second, toRecord(it.first, HDLR_DONE));
+    return commit();
+}
+
+// ***********************************************************************************************
+bool DominoJournal::writeAll(const void* aData, const size_t aNBytes)
+{
+    auto bytes = static_cast<const char*>(aData);
+    for (size_t nDone = 0; nDone < aNBytes;)
+    {
+        const auto n = write(fd_, bytes + nDone, aNBytes - nDone);
+        if (n <= 0) return false;
+        nDone += n;
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+void DominoJournal::topoChanged()
+{
+    if (topoChanged_ || fd_ < 0) return;
+    append(0, TOPO_CHANGE);
+    topoChanged_ = true;
+}
+
+// ***********************************************************************************************
+bool DominoJournal::writeHeader(const uint64_t aTopo)
+{
+    Header header{{}, VERSION, eventBytes_, aTopo};
+    std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+    return ftruncate(fd_, 0) == 0 && lseek(fd_, 0, SEEK_SET) == 0 && writeAll(&header, sizeof(header))
+        && (not sync_ || fdatasync(fd_) == 0);
+}
+}  // namespace
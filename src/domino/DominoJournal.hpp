@@ -0,0 +1,85 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: append-only write-ahead file of Domino's state changes & hdlr done, eg Domino::openJournal()
+//   . file = Header + records; record = 1 uint64_t (event << 3 | Kind)
+//   . group commit: append() into buf_, commit() = 1 write() + fdatasync() + COMMIT record
+//   . open() reads committed records only (torn tail after last COMMIT is cut), then appends
+//   . Header has Domino's topology fingerprint & TOPO_CHANGE marks a later change, so records are
+//     never replayed onto other events (eg renumbered by compact(), or rmEvent() then reused)
+// - why: crash mid-upgrade shall not lose which tiles were true, nor re-run completed hdlrs
+// - limit: native endian & Event width (same build/arch, like DominoSnapshot); not thread-safe
+// - core: fd_, buf_, done_
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RLib
+{
+// ***********************************************************************************************
+class DominoJournal
+{
+public:
+    enum Kind : uint64_t { SET_FALSE, SET_TRUE, HDLR_DONE, COMMIT, TOPO_CHANGE };
+    enum : uint32_t { VERSION = 2 };  // inc when record's meaning changes
+    using Record = uint64_t;
+    using DoneCount = std::unordered_map<uint64_t, size_t>;  // [event]=num of hdlr done since its last change
+
+    static Record toRecord(const uint64_t aEv, const Kind aKind) { return aEv << 3 | aKind; }
+    static uint64_t eventOf(const Record aRec) { return aRec >> 3; }
+    static Kind kindOf(const Record aRec) { return Kind(aRec & 7); }
+
+    DominoJournal() = default;
+    DominoJournal(const DominoJournal&) = delete;
+    DominoJournal& operator=(const DominoJournal&) = delete;
+    ~DominoJournal();  // commit() & close
+
+    // create aPath if not exist; else ret its committed records (w/o COMMIT) into aRecords
+    // false if can't open, header mismatch (other Event width/version, or other aTopo), or any
+    // committed TOPO_CHANGE (topology changed w/o checkpoint, so later records may be other events)
+    bool open(const std::string& aPath, const uint32_t aEventBytes, const uint64_t aTopo,
+        std::vector<Record>& aRecords);
+    void append(const uint64_t aEv, const Kind);
+    void endBatch() { if (++nBatch_ >= batch_) commit(); }  // eg per Domino broadcast
+    bool commit();                                          // false if write/sync failed
+    bool reset(const uint64_t aTopo);                       // empty all but done_ (eg after Domino::save())
+    void topoChanged();                                     // 1 TOPO_CHANGE till reset()
+
+    void setBatch(const size_t aBatch) { batch_ = aBatch ? aBatch : 1; }  // commit per aBatch endBatch()
+    void setSync(const bool aSync) { sync_ = aSync; }                    // fdatasync() per commit
+    const DoneCount& done() const { return done_; }
+    size_t nCommit() const { return nCommit_; }
+
+private:
+    struct Header
+    {
+        char     magic_[8];
+        uint32_t version_;
+        uint32_t eventBytes_;
+        uint64_t topo_;  // Domino's topology fingerprint when open()/reset(), so replay onto same topology only
+    };
+    static constexpr char MAGIC[8] = {'D', 'M', 'N', 'J', 'R', 'N', 'L', '\0'};
+
+    bool writeAll(const void* aData, const size_t aNBytes);
+    bool writeHeader(const uint64_t aTopo);
+    void count(const Record);  // into done_
+
+    // -------------------------------------------------------------------------------------------
+    int fd_ = -1;
+    uint32_t eventBytes_ = 0;
+    std::vector<Record> buf_;  // not committed yet
+    size_t batch_ = 1;
+    size_t nBatch_ = 0;
+    bool sync_ = true;
+    size_t nCommit_ = 0;
+    bool topoChanged_ = false;  // TOPO_CHANGE appended since open()/reset()
+    DoneCount done_;  // kept over reset(), so completed hdlrs survive checkpoint
+};
+}  // namespace
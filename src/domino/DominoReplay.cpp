@@ -0,0 +1,91 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <unordered_set>
+
+#include "DominoReplay.hpp"
+#include "DominoSnapshot.hpp"
+
+namespace RLib
+{
+namespace
+{
+constexpr auto TAG_TRACE = DominoSnapshot::tagOf("trce");
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+BasicDominoReplay<aEvent>::BasicDominoReplay(BasicDomino<aEvent>& aDom, const Records& aRecords,
+    const uint32_t aSrc)
+    : dom_(aDom)
+{
+    std::vector<std::vector<SimuEvName> > open;  // stack: nested setState() in sync hdlr
+    std::unordered_set<uint64_t> hdlrEvs;
+    for (auto&& rec : aRecords)
+    {
+        if (rec.src_ != aSrc) continue;
+        const bool isEv = rec.kind_ == TraceRing::SET_FALSE || rec.kind_ == TraceRing::SET_TRUE
+            || rec.kind_ == TraceRing::TRIGGER_HDLR;
+        if (isEv && (rec.id_ >= aDom.nEvent() || aDom.topo_->evNames_.removed(rec.id_)))
+        {
+            valid_ = false;
+            continue;
+        }
+
+        switch (rec.kind_)
+        {
+        case TraceRing::SET_BEGIN:
+            open.emplace_back();
+            open.back().reserve(rec.id_);
+            break;
+        case TraceRing::SET_FALSE:
+        case TraceRing::SET_TRUE:
+            if (not open.empty()) open.back().emplace_back(aDom.evName(rec.id_), rec.kind_ == TraceRing::SET_TRUE);
+            break;  // empty: SET_BEGIN overwritten in ring
+        case TraceRing::SET_END:
+            if (open.empty()) break;
+            steps_.push_back(std::move(open.back()));
+            open.pop_back();
+            break;
+        case TraceRing::TRIGGER_HDLR:
+            if (hdlrEvs.insert(rec.id_).second) hdlrEvs_.push_back(aDom.evName(rec.id_));
+            break;
+        default:
+            break;
+        }
+    }
+    if (not valid_) steps_.clear();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDominoReplay<aEvent>::load(const std::string& aPath, Records& aRecords)
+{
+    DominoSnapshot snapshot;
+    return snapshot.open(aPath) && snapshot.get(TAG_TRACE, aRecords);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+size_t BasicDominoReplay<aEvent>::run() const
+{
+    for (auto&& step : steps_) dom_.pureSetStates(step);
+    return steps_.size();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicDominoReplay<aEvent>::save(const std::string& aPath, const Records& aRecords)
+{
+    DominoSnapshot snapshot;
+    snapshot.put(TAG_TRACE, aRecords);
+    return snapshot.save(aPath, sizeof(aEvent));
+}
+
+template class BasicDominoReplay<uint16_t>;
+template class BasicDominoReplay<uint32_t>;
+template class BasicDominoReplay<size_t>;
+}  // namespace
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: replay driver of a TraceRing trace, eg reproduce a prod perf issue on a dev host
+//   . save()/load() trace file (DominoSnapshot of records), so record in prod, replay offline
+//   . prepare (ctor): pick 1 Domino's (aSrc) setState() inputs from the trace, resolve EvNames once
+//   . run(): feed them back into a fresh stack (eg MaxDom w/ MsgSelf, load()ed from the recorded
+//     Domino's snapshot) at full speed (no wait per TSC), so the same workload can be benchmarked &
+//     profiled; setHdlr() on hdlrEvNames() 1st (eg no-op) to replay MsgSelf dispatches too
+// - same deduction as recorded if same topology & start states; hdlr's setState() is recorded as
+//   its own input so replayed w/o real hdlr (nested in sync hdlr: replayed after outer's inputs)
+// - limit: topology changes (setPrev()/rmEvent()/etc) are not replayed; recorded Domino's id (aSrc)
+//   changes per compact() & is shared by its copies (trace 1 of them)
+// - core: steps_
+// ***********************************************************************************************
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Domino.hpp"
+#include "TraceRing.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aEvent>
+class BasicDominoReplay
+{
+public:
+    using Records    = TraceRing::Records;
+    using EvNameView = typename BasicDomino<aEvent>::EvNameView;
+    using SimuEvName = typename BasicDomino<aEvent>::SimuEvName;
+
+    static uint32_t srcOf(const BasicDomino<aEvent>& aDom) { return uint32_t(aDom.id_); }  // recorded Domino
+    static bool save(const std::string& aPath, const Records&);
+    static bool load(const std::string& aPath, Records&);
+
+    // aDom must outlive this; false valid() if any recorded event not in aDom (other topology)
+    BasicDominoReplay(BasicDomino<aEvent>& aDom, const Records&, const uint32_t aSrc);
+    bool valid() const { return valid_; }
+    size_t nStep() const { return steps_.size(); }                           // num of setState()
+    const std::vector<EvNameView>& hdlrEvNames() const { return hdlrEvs_; }  // had TRIGGER_HDLR
+    size_t run() const;  // all steps into aDom; ret nStep() (0 if not valid())
+
+private:
+    BasicDomino<aEvent>& dom_;
+    std::vector<std::vector<SimuEvName> > steps_;  // [step]=inputs of 1 setState()
+    std::vector<EvNameView> hdlrEvs_;
+    bool valid_ = true;
+};
+
+using DominoReplay = BasicDominoReplay<size_t>;
+
+extern template class BasicDominoReplay<uint16_t>;
+extern template class BasicDominoReplay<uint32_t>;
+extern template class BasicDominoReplay<size_t>;
+}  // namespace
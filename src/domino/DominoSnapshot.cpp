@@ -0,0 +1,136 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <fcntl.h>     // open
+#include <cstdio>      // rename
+#include <fstream>
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, fsync
+
+#include "DominoSnapshot.hpp"
+
+namespace RLib
+{
+namespace
+{
+// new/renamed dir entry is durable only after its dir is fsync()ed
+bool syncDirOf(const std::string& aPath)
+{
+    const auto slash = aPath.rfind('/');
+    const auto dir = slash == std::string::npos ? std::string(".") : aPath.substr(0, slash + (slash == 0));
+    const auto fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    const bool ok = fd >= 0 && fsync(fd) == 0;
+    if (fd >= 0) close(fd);
+    return ok;
+}
+}
+
+constexpr char DominoSnapshot::MAGIC[8];
+
+// ***********************************************************************************************
+DominoSnapshot::~DominoSnapshot()
+{
+    if (map_) munmap(map_, mapSize_);
+}
+
+// ***********************************************************************************************
+const DominoSnapshot::SectionHdr* DominoSnapshot::find(const Tag aTag, const size_t aElemSize,
+    const size_t aCount) const
+{
+    const auto it = sections_.find(aTag);
+    if (it == sections_.end() || it->second->elemSize_ != aElemSize) return nullptr;
+    return aCount == ANY_COUNT || it->second->count_ == aCount ? it->second : nullptr;
+}
+
+// ***********************************************************************************************
+bool DominoSnapshot::get(const Tag aTag, std::vector<bool>& aVec, const size_t aCount) const
+{
+    const auto sec = find(aTag, 1, aCount);
+    if (sec == nullptr) return false;
+
+    const auto bytes = static_cast<const uint8_t*>(dataOf(sec));
+    aVec.assign(bytes, bytes + sec->count_);
+    return true;
+}
+
+// ***********************************************************************************************
+bool DominoSnapshot::open(const std::string& aPath)
+{
+    const auto fd = ::open(aPath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    const auto size = fstat(fd, &st) == 0 ? size_t(st.st_size) : 0;
+    auto map = size >= sizeof(Header) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);  // mapping stays
+    if (map == MAP_FAILED) return false;
+
+    if (map_) munmap(map_, mapSize_);
+    map_ = map;
+    mapSize_ = size;
+    sections_.clear();
+
+    const auto begin = static_cast<const char*>(map_);
+    const auto header = reinterpret_cast<const Header*>(begin);
+    if (std::memcmp(header->magic_, MAGIC, sizeof(MAGIC)) || header->version_ != VERSION
+        || header->nBytes_ != mapSize_) return false;
+    eventBytes_ = header->eventBytes_;
+
+    for (size_t offset = sizeof(Header); offset < mapSize_;)  // each section must be within file
+    {
+        if (mapSize_ - offset < sizeof(SectionHdr)) return false;
+        const auto sec = reinterpret_cast<const SectionHdr*>(begin + offset);
+        const auto nBytes = sec->elemSize_ * sec->count_;
+        if (sec->elemSize_ && nBytes / sec->elemSize_ != sec->count_) return false;  // overflow
+        if (nBytes > mapSize_ - offset - sizeof(SectionHdr)) return false;
+        sections_[sec->tag_] = sec;
+        offset += sizeof(SectionHdr) + (nBytes + 7) / 8 * 8;
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+void DominoSnapshot::put(const Tag aTag, const std::vector<bool>& aVec)
+{
+    const std::vector<uint8_t> bytes(aVec.begin(), aVec.end());
+    putRaw(aTag, bytes.data(), 1, bytes.size());
+}
+
+// ***********************************************************************************************
+void DominoSnapshot::putRaw(const Tag aTag, const void* aData, const size_t aElemSize, const size_t aCount)
+{
+    const SectionHdr sec{aTag, uint32_t(aElemSize), aCount};
+    const auto nBytes = aElemSize * aCount;
+    const auto offset = buf_.size();
+    buf_.resize(offset + sizeof(sec) + (nBytes + 7) / 8 * 8, 0);  // keep next section 8-aligned
+    std::memcpy(buf_.data() + offset, &sec, sizeof(sec));
+    if (nBytes) std::memcpy(buf_.data() + offset + sizeof(sec), aData, nBytes);
+}
+
+// ***********************************************************************************************
+bool DominoSnapshot::save(const std::string& aPath, const uint32_t aEventBytes) const
+{
+    Header header{{}, VERSION, aEventBytes, sizeof(Header) + buf_.size()};
+    std::memcpy(header.magic_, MAGIC, sizeof(MAGIC));
+
+    {
+        std::ofstream file(aPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(buf_.data(), buf_.size());
+        if (not file.flush()) return false;
+    }
+    const auto fd = ::open(aPath.c_str(), O_RDONLY);  // durable before eg journal reset by checkpoint
+    const bool ok = fd >= 0 && fsync(fd) == 0;
+    if (fd >= 0) close(fd);
+    return ok && syncDirOf(aPath);
+}
+
+// ***********************************************************************************************
+bool DominoSnapshot::replace(const std::string& aFrom, const std::string& aTo)
+{
+    return std::rename(aFrom.c_str(), aTo.c_str()) == 0 && syncDirOf(aTo);
+}
+}  // namespace
@@ -0,0 +1,116 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: versioned binary file of tagged POD arrays (sections), eg Domino::save()/load()
+//   . file = Header + sections; section = SectionHdr + raw array, padded to 8 bytes
+//   . read by mmap: open() only checks header & indexes sections, get() = 1 memcpy per array
+// - why: warm restart - rebuild big Domino by 1000s setPrev() costs seconds, bulk copy costs ms
+// - limit: native endian & widths (same build/arch), checked by magic & eventBytes
+// - core: buf_ (write), map_ & sections_ (read)
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RLib
+{
+// ***********************************************************************************************
+class DominoSnapshot
+{
+public:
+    using Tag = uint32_t;
+    enum : uint32_t { VERSION = 1 };  // inc when any section's meaning changes
+    enum : size_t { ANY_COUNT = static_cast<size_t>(-1) };
+
+    static constexpr Tag tagOf(const char (&aName)[5])  // eg tagOf("name")
+    {
+        return Tag(uint8_t(aName[0])) | Tag(uint8_t(aName[1])) << 8 | Tag(uint8_t(aName[2])) << 16
+            | Tag(uint8_t(aName[3])) << 24;
+    }
+
+    DominoSnapshot() = default;
+    DominoSnapshot(const DominoSnapshot&) = delete;
+    DominoSnapshot& operator=(const DominoSnapshot&) = delete;
+    ~DominoSnapshot();  // munmap
+
+    // -------------------------------------------------------------------------------------------
+    // write: put() sections then save()
+    template<class aPod> void put(const Tag, const std::vector<aPod>&);
+    void put(const Tag, const std::vector<bool>&);  // 1 byte per bool
+    void put(const Tag aTag, const std::string& aBytes) { putRaw(aTag, aBytes.data(), 1, aBytes.size()); }
+    bool save(const std::string& aPath, const uint32_t aEventBytes) const;  // fsync file & its dir
+    static bool replace(const std::string& aFrom, const std::string& aTo);  // atomic rename() + fsync dir
+
+    // -------------------------------------------------------------------------------------------
+    // read: open() then get(); false if absent, wrong elem size or count != aCount
+    bool open(const std::string& aPath);  // false if no file, bad magic/version or truncated
+    uint32_t eventBytes() const { return eventBytes_; }
+    bool has(const Tag aTag) const { return sections_.count(aTag) > 0; }
+    template<class aPod> bool get(const Tag, std::vector<aPod>&, const size_t aCount = ANY_COUNT) const;
+    bool get(const Tag, std::vector<bool>&, const size_t aCount = ANY_COUNT) const;
+    template<class aPod> const aPod* view(const Tag, size_t& aCount) const;  // into mmap, w/o copy; null if absent
+
+private:
+    struct Header
+    {
+        char     magic_[8];
+        uint32_t version_;
+        uint32_t eventBytes_;  // sizeof(Domino's Event)
+        uint64_t nBytes_;      // whole file, to detect truncate
+    };
+    struct SectionHdr
+    {
+        Tag      tag_;
+        uint32_t elemSize_;
+        uint64_t count_;
+    };
+    static constexpr char MAGIC[8] = {'D', 'M', 'N', 'S', 'N', 'A', 'P', '\0'};
+
+    void putRaw(const Tag, const void* aData, const size_t aElemSize, const size_t aCount);
+    const SectionHdr* find(const Tag, const size_t aElemSize, const size_t aCount) const;
+    static const void* dataOf(const SectionHdr* aSec) { return aSec + 1; }
+
+    // -------------------------------------------------------------------------------------------
+    std::vector<char> buf_;  // sections to save()
+
+    void*    map_ = nullptr;  // open()ed file
+    size_t   mapSize_ = 0;
+    uint32_t eventBytes_ = 0;
+    std::unordered_map<Tag, const SectionHdr*> sections_;  // into map_
+};
+
+// ***********************************************************************************************
+template<class aPod>
+void DominoSnapshot::put(const Tag aTag, const std::vector<aPod>& aVec)
+{
+    putRaw(aTag, aVec.data(), sizeof(aPod), aVec.size());
+}
+
+// ***********************************************************************************************
+template<class aPod>
+const aPod* DominoSnapshot::view(const Tag aTag, size_t& aCount) const
+{
+    const auto sec = find(aTag, sizeof(aPod), ANY_COUNT);
+    aCount = sec ? sec->count_ : 0;
+    return sec ? static_cast<const aPod*>(dataOf(sec)) : nullptr;
+}
+
+// ***********************************************************************************************
+template<class aPod>
+bool DominoSnapshot::get(const Tag aTag, std::vector<aPod>& aVec, const size_t aCount) const
+{
+    const auto sec = find(aTag, sizeof(aPod), aCount);
+    if (sec == nullptr) return false;
+
+    aVec.resize(sec->count_);
+    if (sec->count_) std::memcpy(aVec.data(), dataOf(sec), sec->count_ * sizeof(aPod));
+    return true;
+}
+}  // namespace
@@ -0,0 +1,200 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+#include <random>
+
+#include "DominoWorkload.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+// only raw mt19937_64 output (fully specified by std), so same cfg = same workload everywhere
+class WorkloadGen
+{
+public:
+    using Node = DominoWorkload::Node;
+
+    explicit WorkloadGen(const WorkloadCfg& aCfg) : cfg_(aCfg), rand_(aCfg.seed) { wl_.nEvent = aCfg.nEvent; }
+
+    DominoWorkload gen()
+    {
+        if (cfg_.shape == WorkloadCfg::PHASED_PIPELINE) phasedPipeline();
+        else if (cfg_.shape == WorkloadCfg::FAN_IN_BARRIER) fanInBarrier();
+        else randomDag();
+        genStimuli();
+        return std::move(wl_);
+    }
+
+private:
+    size_t below(const size_t aN) { return rand_() % aN; }  // aN > 0; tiny bias is fine here
+    bool byPct(const size_t aPct) { return below(100) < aPct; }
+    void addEdge(const Node aPrev, const Node aNext) { wl_.edges.push_back({aPrev, aNext, not byPct(cfg_.falsePct)}); }
+    void addNonInput(const Node aEv)
+    {
+        if (byPct(cfg_.hdlrPct)) wl_.hdlrEvents.push_back(aEv);
+    }
+    void shuffle(std::vector<Node>& aNodes, const size_t aBegin)  // Fisher-Yates, [aBegin, end)
+    {
+        for (auto idx = aNodes.size(); idx > aBegin + 1; --idx)
+            std::swap(aNodes[idx - 1], aNodes[aBegin + below(idx - aBegin)]);
+    }
+
+    void randomDag();
+    void phasedPipeline();
+    void fanInBarrier();
+    void genStimuli();
+
+    // -------------------------------------------------------------------------------------------
+    const WorkloadCfg  cfg_;
+    std::mt19937_64    rand_;
+    DominoWorkload     wl_;
+    std::vector<Node>  inputs_;  // in stimulus order
+};
+
+// ***********************************************************************************************
+void WorkloadGen::fanInBarrier()
+{
+    const size_t nEvent = cfg_.nEvent;
+    if (nEvent == 0) return;
+
+    const size_t width = std::max<size_t>(cfg_.fanIn, 1);
+    const size_t nGroup = (nEvent - 1) / (width + 1);
+    const Node nDirect = nEvent - 1 - nGroup * (width + 1);  // extra inputs -> final barrier directly
+    wl_.edges.reserve(nEvent - 1);
+
+    std::vector<Node> barriers;
+    for (Node ev = 0; ev < nDirect; ++ev) inputs_.push_back(ev);
+    for (size_t group = 0; group < nGroup; ++group)
+    {
+        const Node first = nDirect + group * (width + 1);
+        const Node barrier = first + width;
+        for (Node ev = first; ev < barrier; ++ev) inputs_.push_back(ev);
+        for (Node ev = first; ev < barrier; ++ev) addEdge(ev, barrier);
+        addNonInput(barrier);
+        barriers.push_back(barrier);
+    }
+    const Node top = nEvent - 1;
+    if (top == 0)
+    {
+        inputs_.push_back(top);
+        return;
+    }
+    for (Node ev = 0; ev < nDirect; ++ev) addEdge(ev, top);
+    for (auto&& barrier : barriers) addEdge(barrier, top);
+    addNonInput(top);
+    shuffle(inputs_, 0);
+}
+
+// ***********************************************************************************************
+void WorkloadGen::phasedPipeline()
+{
+    const size_t nEvent = cfg_.nEvent;
+    const size_t perTask = 1 + std::max<size_t>(cfg_.chainLen, 1);  // ack + steps
+    const size_t nPhase = std::max<size_t>(1, std::min(cfg_.nPhase, nEvent / (perTask + 1)));
+    const size_t nTask = nEvent == 0 ? 0 : (nEvent / nPhase - 1) / perTask;
+    if (nTask == 0)  // too small to have any task: all inputs
+    {
+        for (Node ev = 0; ev < nEvent; ++ev) inputs_.push_back(ev);
+        return;
+    }
+    const Node nLateAck = nEvent - nPhase * (1 + nTask * perTask);  // extra acks -> last barrier
+    wl_.edges.reserve(nEvent);
+
+    Node id = nLateAck;
+    Node barrier = 0;
+    std::vector<Node> tails;
+    for (size_t phase = 0; phase < nPhase; ++phase)
+    {
+        const auto phaseInputs = inputs_.size();
+        tails.clear();
+        for (size_t task = 0; task < nTask; ++task)
+        {
+            const Node ack = id++;
+            inputs_.push_back(ack);
+            Node step = id++;
+            addEdge(ack, step);
+            if (phase > 0) addEdge(barrier, step);
+            addNonInput(step);
+            for (size_t idx = 2; idx < perTask; ++idx, ++id)
+            {
+                addEdge(step, id);
+                addNonInput(id);
+                step = id;
+            }
+            tails.push_back(step);
+        }
+        shuffle(inputs_, phaseInputs);  // acks of a phase come in any order
+
+        barrier = id++;
+        for (auto&& tail : tails) addEdge(tail, barrier);
+        if (phase + 1 == nPhase)
+            for (Node ack = 0; ack < nLateAck; ++ack) addEdge(ack, barrier);
+        addNonInput(barrier);
+    }
+    for (Node ack = 0; ack < nLateAck; ++ack) inputs_.push_back(ack);
+}
+
+// ***********************************************************************************************
+void WorkloadGen::randomDag()
+{
+    const size_t nEvent = cfg_.nEvent;
+    const size_t nInput = std::min<size_t>(nEvent, std::max<size_t>(1, nEvent / 16));
+    const size_t maxPrev = std::max<size_t>(cfg_.maxPrev, 1);
+    wl_.edges.reserve((nEvent - nInput) * (maxPrev + 1) / 2);
+
+    for (Node ev = 0; ev < nInput; ++ev) inputs_.push_back(ev);
+    std::vector<Node> prevs;
+    for (Node next = nInput; next < nEvent; ++next)
+    {
+        prevs.clear();
+        for (auto nPrev = std::min<size_t>(1 + below(maxPrev), next); prevs.size() < nPrev;)
+        {
+            const Node prev = below(next);
+            if (std::find(prevs.begin(), prevs.end(), prev) == prevs.end()) prevs.push_back(prev);
+        }
+        std::sort(prevs.begin(), prevs.end());
+        for (auto&& prev : prevs) addEdge(prev, next);
+        addNonInput(next);
+    }
+    shuffle(inputs_, 0);
+}
+
+// ***********************************************************************************************
+// each input -> true once in inputs_ order; falsePct of them retracted (-> false) at next step
+void WorkloadGen::genStimuli()
+{
+    const size_t stepSize = std::max<size_t>(cfg_.stepSize, 1);
+    wl_.stimuli.reserve(inputs_.size() * (100 + cfg_.falsePct) / 100);
+
+    std::vector<Node> pending;
+    for (size_t idx = 0; idx < inputs_.size() || not pending.empty(); idx += stepSize)
+    {
+        wl_.stepBegins.push_back(wl_.stimuli.size());
+        for (auto&& ev : pending) wl_.stimuli.push_back({ev, false});
+        pending.clear();
+        for (auto ev = idx; ev < std::min(idx + stepSize, inputs_.size()); ++ev)
+        {
+            wl_.stimuli.push_back({inputs_[ev], true});
+            if (byPct(cfg_.falsePct)) pending.push_back(inputs_[ev]);
+        }
+    }
+}
+
+// ***********************************************************************************************
+DominoWorkload genWorkload(const WorkloadCfg& aCfg)
+{
+    return WorkloadGen(aCfg).gen();
+}
+
+// ***********************************************************************************************
+size_t DominoWorkload::nInput() const
+{
+    std::vector<bool> hasPrev(nEvent);
+    for (auto&& edge : edges) hasPrev[edge.next] = true;
+    return std::count(hasPrev.begin(), hasPrev.end(), false);
+}
+}  // namespace
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: synthetic Domino topology + setState() stream, for benchmark & capacity planning
+//   . RANDOM_DAG:      each event has 1~maxPrev random earlier prev(s)
+//   . PHASED_PIPELINE: like eNB upgrade - per phase, tasks (ack -> step chain) gated by the
+//                      previous phase's barrier, and all tasks gate this phase's barrier
+//   . FAN_IN_BARRIER:  groups of fanIn inputs -> group barrier -> final barrier
+//   . falsePct (any shape): % of edges requiring prev=false & % of inputs retracted later
+// - why:
+//   . real graphs are not shareable, synthetic ones are; same cfg(+seed) = same workload on any
+//     machine/compiler (mt19937_64 is fully specified, no std distribution used)
+//   . replay via public interface only, so measures what users get
+// - event id = topological order (prev < next), EvName = DominoWorkload::evName(event)
+// - core: genWorkload(), loadWorkload()/loadWorkloadGraph(), replayStep()
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Domino.hpp"
+#include "MsgSelf.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct WorkloadCfg
+{
+    enum Shape { RANDOM_DAG, PHASED_PIPELINE, FAN_IN_BARRIER };
+
+    Shape    shape    = RANDOM_DAG;
+    size_t   nEvent   = 1000;      // exact num of events generated, 10^3 ~ 10^7
+    uint64_t seed     = 20170104;  // same seed = same workload
+    size_t   maxPrev  = 4;         // RANDOM_DAG: prevs per non-input event
+    size_t   nPhase   = 8;         // PHASED_PIPELINE
+    size_t   chainLen = 3;         // PHASED_PIPELINE: steps per task (eg download->verify->activate)
+    size_t   fanIn    = 1024;      // FAN_IN_BARRIER: inputs per group barrier
+    size_t   falsePct = 0;         // 0~100, mixed true/false preconditions
+    size_t   hdlrPct  = 10;        // 0~100, % of non-input events w/ hdlr
+    size_t   stepSize = 1;         // stimuli per setState()
+};
+
+// ***********************************************************************************************
+struct DominoWorkload
+{
+    using Node = uint32_t;  // 10^7 events fit; half mem of size_t
+
+    struct Edge
+    {
+        Node prev;
+        Node next;
+        bool prevState;  // state of prev that satisfies next
+    };
+    struct Stimulus
+    {
+        Node event;
+        bool state;
+    };
+
+    size_t nEvent = 0;
+    std::vector<Edge> edges;          // grouped by next, ascending
+    std::vector<Node> hdlrEvents;     // events w/ hdlr, ascending
+    std::vector<Stimulus> stimuli;    // replay in order
+    std::vector<size_t> stepBegins;   // [step]=1st stimulus of the step's setState()
+
+    size_t nStep() const { return stepBegins.size(); }
+    size_t nInput() const;            // events w/o prev (only changed by stimuli)
+
+    static std::string evName(const size_t aEvent)
+    {
+        return "/wl:dut/task[id=" + std::to_string(aEvent) + "]/done";
+    }
+};
+
+DominoWorkload genWorkload(const WorkloadCfg&);
+
+// ***********************************************************************************************
+// driver: work on any Domino of the family (eg MaxDom)
+// ***********************************************************************************************
+template<class aDominoType>
+void loadWorkload(aDominoType& aDom, const DominoWorkload& aWl)  // newEvent() + setPrev()
+{
+    for (size_t ev = 0; ev < aWl.nEvent; ++ev) aDom.newEvent(DominoWorkload::evName(ev));
+    for (auto&& edge : aWl.edges)
+        aDom.setPrev(DominoWorkload::evName(edge.next), {{DominoWorkload::evName(edge.prev), edge.prevState}});
+}
+
+template<class aDominoType>
+bool loadWorkloadGraph(aDominoType& aDom, const DominoWorkload& aWl)  // 1 loadGraph()
+{
+    std::vector<std::string> evNames;
+    evNames.reserve(aWl.nEvent);
+    for (size_t ev = 0; ev < aWl.nEvent; ++ev) evNames.push_back(DominoWorkload::evName(ev));
+    std::vector<typename aDominoType::GraphEdge> edges;
+    edges.reserve(aWl.edges.size());
+    for (auto&& edge : aWl.edges) edges.push_back({edge.prev, edge.next, edge.prevState});
+    return aDom.loadGraph(std::vector<typename aDominoType::EvNameView>(evNames.begin(), evNames.end()), edges);
+}
+
+// ***********************************************************************************************
+template<class aHdlrDominoType>
+void setWorkloadHdlr(aHdlrDominoType& aDom, const DominoWorkload& aWl, const MsgCB& aHdlr)
+{
+    for (auto&& ev : aWl.hdlrEvents) aDom.setHdlr(DominoWorkload::evName(ev), aHdlr);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void replayStep(aDominoType& aDom, const DominoWorkload& aWl, const size_t aStep)  // aStep < nStep()
+{
+    const auto begin = aWl.stepBegins[aStep];
+    const auto end = aStep + 1 < aWl.nStep() ? aWl.stepBegins[aStep + 1] : aWl.stimuli.size();
+    if (end - begin == 1)
+    {
+        aDom.setState(DominoWorkload::evName(aWl.stimuli[begin].event), aWl.stimuli[begin].state);
+        return;
+    }
+    Domino::SimuEvents simuEvents;
+    for (auto idx = begin; idx < end; ++idx)
+        simuEvents[DominoWorkload::evName(aWl.stimuli[idx].event)] = aWl.stimuli[idx].state;
+    aDom.setState(simuEvents);
+}
+
+template<class aDominoType>
+void replayWorkload(aDominoType& aDom, const DominoWorkload& aWl)
+{
+    for (size_t step = 0; step < aWl.nStep(); ++step) replayStep(aDom, aWl, step);
+}
+}  // namespace
@@ -0,0 +1,261 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+#include <limits>
+
+#include "EdgeCsr.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::add(const Node aFrom, const Edge aEdge)
+{
+    overflow_[aFrom].push_back(aEdge);
+    ++nOverflow_;
+    if (nOverflow_ > std::max<size_t>(edges_.size(), MIN_OVERFLOW)) compact();
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::clear(const Node aFrom)
+{
+    const auto nCsr = csrDegree(aFrom);
+    if (nCsr)
+    {
+        ranges_[aFrom].second = ranges_[aFrom].first;
+        nHole_ += nCsr;
+    }
+    auto&& it = overflow_.find(aFrom);
+    if (it == overflow_.end()) return;
+    nOverflow_ -= it->second.size();
+    overflow_.erase(it);
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+typename BasicEdgeCsr<aNodeType>::Edge BasicEdgeCsr<aNodeType>::at(const Node aFrom, const size_t aIdx) const
+{
+    const auto nCsr = csrDegree(aFrom);
+    if (aIdx < nCsr) return edges_[ranges_[aFrom].first + aIdx];
+    return overflow_.at(aFrom)[aIdx - nCsr];
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::build(const size_t aNNode, const std::vector<Node>& aFroms,
+    const std::vector<Edge>& aEdges)
+{
+    ranges_.assign(aNNode, {0, 0});
+    for (auto&& from : aFroms) ++ranges_[from].second;  // degree 1st
+    Offset begin = 0;
+    for (auto&& range : ranges_)
+    {
+        range.first = begin;
+        begin += range.second;
+        range.second = range.first;  // then as fill cursor till end
+    }
+    edges_.reserve(std::max(aEdges.size(), nReserved_));
+    edges_.resize(aEdges.size());
+    for (size_t idx = 0; idx < aEdges.size(); ++idx) edges_[ranges_[aFroms[idx]].second++] = aEdges[idx];
+
+    overflow_.clear();
+    nOverflow_ = 0;
+    nHole_ = 0;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::compact()
+{
+    if (nOverflow_ == 0 && nHole_ == 0) return;
+    compact(std::vector<Node>());
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::compact(const std::vector<Node>& aOrder)
+{
+    size_t nNode = ranges_.size();
+    for (auto&& it : overflow_) nNode = std::max<size_t>(nNode, it.first + 1);
+
+    std::vector<std::pair<Offset, Offset> > ranges(nNode, {0, 0});
+    std::vector<Edge> edges;
+    edges.reserve(std::max(nEdge(), nReserved_));
+    std::vector<bool> done(nNode, false);
+    auto&& moveNode = [&](const Node aNode)
+    {
+        if (aNode >= nNode || done[aNode]) return;
+        done[aNode] = true;
+        ranges[aNode].first = edges.size();
+        const auto nCsr = csrDegree(aNode);
+        if (nCsr) edges.insert(edges.end(), edges_.begin() + ranges_[aNode].first,
+            edges_.begin() + ranges_[aNode].second);
+
+        auto&& it = overflow_.find(aNode);
+        if (it != overflow_.end()) edges.insert(edges.end(), it->second.begin(), it->second.end());
+        ranges[aNode].second = edges.size();
+    };
+    for (auto&& node : aOrder) moveNode(node);
+    for (Node node = 0; node < nNode; ++node) moveNode(node);
+
+    ranges_.swap(ranges);
+    edges_.swap(edges);
+    overflow_.clear();
+    nOverflow_ = 0;
+    nHole_ = 0;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+size_t BasicEdgeCsr<aNodeType>::degree(const Node aFrom) const
+{
+    const auto nCsr = csrDegree(aFrom);
+    if (nOverflow_ == 0) return nCsr;
+
+    auto&& it = overflow_.find(aFrom);
+    return it == overflow_.end() ? nCsr : nCsr + it->second.size();
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+bool BasicEdgeCsr<aNodeType>::has(const Node aFrom, const Edge aEdge) const
+{
+    for (size_t idx = 0, nEdge = degree(aFrom); idx < nEdge; ++idx)
+    {
+        if (at(aFrom, idx) == aEdge) return true;
+    }
+    return false;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+bool BasicEdgeCsr<aNodeType>::load(const DominoSnapshot& aSnap, const Tag aRangesTag, const Tag aEdgesTag,
+    const size_t aNNode)
+{
+    std::vector<uint64_t> ranges;
+    std::vector<Edge> edges;
+    if (not aSnap.get(aRangesTag, ranges) || not aSnap.get(aEdgesTag, edges) || ranges.size() % 2
+        || ranges.size() / 2 > aNNode || edges.size() > std::numeric_limits<Offset>::max()) return false;
+
+    // each node's [begin, end) within edges & not overlap other node's (else rm() corrupts neighbor)
+    std::vector<std::pair<uint64_t, uint64_t> > blocks;
+    for (size_t idx = 0; idx < ranges.size(); idx += 2)
+    {
+        if (ranges[idx] > ranges[idx + 1] || ranges[idx + 1] > edges.size()) return false;
+        if (ranges[idx] < ranges[idx + 1]) blocks.emplace_back(ranges[idx], ranges[idx + 1]);
+    }
+    std::sort(blocks.begin(), blocks.end());
+    for (size_t idx = 1; idx < blocks.size(); ++idx)
+        if (blocks[idx].first < blocks[idx - 1].second) return false;
+    for (auto&& edge : edges)
+        if (nodeOf(edge) >= aNNode) return false;
+
+    ranges_.resize(ranges.size() / 2);
+    size_t nUsed = 0;
+    for (size_t node = 0; node < ranges_.size(); ++node)
+    {
+        ranges_[node] = {Offset(ranges[node * 2]), Offset(ranges[node * 2 + 1])};
+        nUsed += ranges_[node].second - ranges_[node].first;
+    }
+    edges_.swap(edges);
+    overflow_.clear();
+    nOverflow_ = 0;
+    nHole_ = edges_.size() - std::min(nUsed, edges_.size());
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+size_t BasicEdgeCsr<aNodeType>::nBytes() const
+{
+    auto nBytes = ranges_.capacity() * sizeof(ranges_[0]) + edges_.capacity() * sizeof(Edge);
+    for (auto&& it : overflow_) nBytes += sizeof(it) + it.second.capacity() * sizeof(Edge);
+    return nBytes;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::renumber(const std::vector<Node>& aNewOf)
+{
+    compact();
+    for (auto&& edge : edges_) edge = toEdge(aNewOf[nodeOf(edge)], flagOf(edge));
+
+    size_t nNode = 0;  // aNewOf monotonic, so blocks stay in new node order
+    for (Node node = 0; node < ranges_.size(); ++node)
+    {
+        if (aNewOf[node] == Node(-1)) continue;  // removed, no edge
+        ranges_[aNewOf[node]] = ranges_[node];
+        nNode = aNewOf[node] + 1;
+    }
+    ranges_.resize(nNode);
+    ranges_.shrink_to_fit();
+    edges_.shrink_to_fit();
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::reserve(const size_t aNNode, const size_t aNEdge)
+{
+    ranges_.reserve(aNNode);
+    edges_.reserve(aNEdge);
+    nReserved_ = aNEdge;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+bool BasicEdgeCsr<aNodeType>::rm(const Node aFrom, const Edge aEdge)
+{
+    const auto nCsr = csrDegree(aFrom);
+    const auto begin = edges_.begin() + (nCsr ? ranges_[aFrom].first : 0);
+    const auto found = std::find(begin, begin + nCsr, aEdge);
+    if (found != begin + nCsr)
+    {
+        std::copy(found + 1, begin + nCsr, found);
+        --ranges_[aFrom].second;
+        ++nHole_;
+        return true;
+    }
+
+    auto&& it = overflow_.find(aFrom);
+    if (it == overflow_.end()) return false;
+    auto&& edges = it->second;
+    const auto foundOf = std::find(edges.begin(), edges.end(), aEdge);
+    if (foundOf == edges.end()) return false;
+    edges.erase(foundOf);
+    --nOverflow_;
+    if (edges.empty()) overflow_.erase(it);
+    return true;
+}
+
+// ***********************************************************************************************
+template<class aNodeType>
+void BasicEdgeCsr<aNodeType>::save(DominoSnapshot& aSnap, const Tag aRangesTag, const Tag aEdgesTag) const
+{
+    if (nOverflow_ || nHole_)
+    {
+        auto merged = *this;
+        merged.compact();
+        merged.save(aSnap, aRangesTag, aEdgesTag);
+        return;
+    }
+    std::vector<uint64_t> ranges;
+    ranges.reserve(ranges_.size() * 2);
+    for (auto&& range : ranges_)
+    {
+        ranges.push_back(range.first);
+        ranges.push_back(range.second);
+    }
+    aSnap.put(aRangesTag, ranges);
+    aSnap.put(aEdgesTag, edges_);
+}
+
+// ***********************************************************************************************
+template class BasicEdgeCsr<uint16_t>;
+template class BasicEdgeCsr<uint32_t>;
+template class BasicEdgeCsr<size_t>;
+}  // namespace
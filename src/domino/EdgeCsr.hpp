@@ -0,0 +1,102 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: compact adjacency of Domino (prev_/next_), CSR = Compressed Sparse Row
+//   . ranges_[node] = [begin, end) of the node's edges in edges_
+//   . each edge = (node << 1) | flag, so polarity (true/false prev) costs no extra mem
+//   . aNodeType = width of node & edge (eg uint16_t/uint32_t for smaller mem), node must <= max >> 1
+// - why:
+//   * map<Event, set<Event>> chases tree nodes twice per hop, mostly cache miss in big graph
+//   . CSR is 1 contiguous array, ~8 bytes/edge (vs ~50 bytes/edge of set node)
+// - how to support add edge at any time (Domino::setPrev())?
+//   . new edge is buffered in overflow_ first, then merged into CSR by compact()
+//   . auto compact() when overflow > CSR (geometric, amortized O(1) per edge)
+//   . owner may compact() once setup done (eg Domino before broadcast, see flat()) so degree()/at()
+//     skip overflow_'s hash lookup
+//   . compact() keeps each node's edge order, so index-loop (at()) is safe even if edge added
+//     during the loop (eg hdlr calls setPrev() during Domino broadcast)
+// - compact(aOrder): node blocks laid out in aOrder (eg topological) so broadcast walks edges_
+//   mostly forward (Domino::freeze())
+// - rm edge: shift the rest of the node's block (order kept), hole at block end till compact()
+// - core: ranges_, edges_
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <type_traits>  // conditional
+#include <unordered_map>
+#include <utility>  // pair
+#include <vector>
+
+#include "DominoSnapshot.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aNodeType>
+class BasicEdgeCsr
+{
+public:
+    using Node = aNodeType;
+    using Edge = aNodeType;  // = (node << 1) | flag
+
+    static Edge toEdge(const Node aNode, const bool aFlag) { return Edge((aNode << 1) | Edge(aFlag)); }
+    static Node nodeOf(const Edge aEdge) { return aEdge >> 1; }
+    static bool flagOf(const Edge aEdge) { return aEdge & 1; }
+
+    void   add(const Node aFrom, const Edge aEdge);  // caller to avoid dup (by has())
+    bool   rm(const Node aFrom, const Edge aEdge);   // false if not exist
+    void   clear(const Node aFrom);                  // rm all edges of aFrom
+    bool   has(const Node aFrom, const Edge aEdge) const;
+    size_t degree(const Node aFrom) const;
+    Edge   at(const Node aFrom, const size_t aIdx) const;  // aIdx must < degree(aFrom)
+
+    // replace all by aEdges[i] of aFroms[i] (counting sort, each node's edges in aEdges' order), no
+    // overflow; O(aNNode + nEdge) vs add() per edge; caller to avoid dup & ensure aFroms[i] < aNNode
+    void build(const size_t aNNode, const std::vector<Node>& aFroms, const std::vector<Edge>& aEdges);
+    void reserve(const size_t aNNode, const size_t aNEdge);  // CSR mem, kept by compact()
+
+    void compact();                               // merge overflow_ into CSR, node blocks by node id
+    void compact(const std::vector<Node>& aOrder);  // node blocks by aOrder 1st, then the rest by id
+    void renumber(const std::vector<Node>& aNewOf);  // [old]=new node (monotonic, max=rm'ed w/o edge)
+
+    // snapshot: CSR as is (overflow merged 1st), so node blocks keep compact(aOrder)'s layout
+    using Tag = DominoSnapshot::Tag;
+    void save(DominoSnapshot&, const Tag aRangesTag, const Tag aEdgesTag) const;
+    bool load(const DominoSnapshot&, const Tag aRangesTag, const Tag aEdgesTag, const size_t aNNode);  // false if bad
+
+    // -------------------------------------------------------------------------------------------
+    // misc:
+    size_t nEdge() const { return edges_.size() - nHole_ + nOverflow_; }
+    size_t nBytes() const;  // approximate mem footprint, eg for benchmark
+    bool   flat() const { return nOverflow_ == 0; }  // all edges in CSR, no hash lookup
+
+    enum { MIN_OVERFLOW = 64 };  // not compact() too often for small graph
+
+private:
+    size_t csrDegree(const Node aFrom) const
+    {
+        return aFrom < ranges_.size() ? ranges_[aFrom].second - ranges_[aFrom].first : 0;
+    }
+
+    // -------------------------------------------------------------------------------------------
+    // nEdge <= 2 * nNode^2: fits uint32_t for 15-bit node, else size_t
+    using Offset = std::conditional_t<(sizeof(aNodeType) <= sizeof(uint16_t)), uint32_t, size_t>;
+
+    std::vector<std::pair<Offset, Offset> > ranges_;         // [node]=[1st edge, end) in edges_
+    std::vector<Edge>   edges_;                              // grouped by node, contiguous
+    std::unordered_map<Node, std::vector<Edge> > overflow_;  // [node]=edges added after compact()
+    size_t nOverflow_ = 0;
+    size_t nHole_ = 0;  // in edges_ by rm()
+    size_t nReserved_ = 0;  // min capacity of edges_, see reserve()
+};
+
+using EdgeCsr = BasicEdgeCsr<size_t>;
+
+extern template class BasicEdgeCsr<uint16_t>;
+extern template class BasicEdgeCsr<uint32_t>;
+extern template class BasicEdgeCsr<size_t>;
+}  // namespace
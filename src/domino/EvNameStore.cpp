@@ -0,0 +1,226 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+#include <cstring>  // memcpy
+
+#include "EvNameStore.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+EvNameStore::EvNameStore(const EvNameStore& aRhs)
+    : phash_(aRhs.phash_)
+    , free_(aRhs.free_)
+    , nCollision_(aRhs.nCollision_)
+    , frozen_(aRhs.frozen_)
+{
+    names_.reserve(aRhs.names_.size());
+    for (auto&& name : aRhs.names_) names_.push_back(name.data() ? store(name) : name);
+    if (not frozen_) events_ = decltype(events_)(aRhs.events_.bucket_count());
+    for (Event ev = 0; not frozen_ && ev < names_.size(); ++ev)
+        if (not removed(ev)) events_.emplace(HashedEvName(names_[ev]), ev);
+}
+
+// ***********************************************************************************************
+EvNameStore::Event EvNameStore::add(const HashedEvName& aEvName)
+{
+    Event event = names_.size();
+    if (free_.empty()) names_.push_back(store(aEvName.name()));
+    else
+    {
+        event = free_.back();
+        free_.pop_back();
+        names_[event] = store(aEvName.name());
+    }
+    const HashedEvName key(names_[event]);  // refer arena; rehash only at registration
+    events_.emplace(key, event);
+    nCollision_ += nSameHash(key);
+    return event;
+}
+
+// ***********************************************************************************************
+std::vector<EvNameStore::Event> EvNameStore::compact()
+{
+    std::vector<Event> newOf(names_.size(), NOT_FOUND);
+    std::vector<std::string_view> names;
+    for (Event ev = 0; ev < names_.size(); ++ev)
+    {
+        if (removed(ev)) continue;
+        newOf[ev] = names.size();
+        names.push_back(names_[ev]);
+    }
+
+    EvNameStore packed;  // fresh arena w/ live EvNames only
+    packed.events_.reserve(names.size());
+    for (auto&& name : names) packed.add(HashedEvName(name));
+    std::swap(chunks_, packed.chunks_);
+    std::swap(chunkSize_, packed.chunkSize_);
+    std::swap(chunkUsed_, packed.chunkUsed_);
+    std::swap(nChunkBytes_, packed.nChunkBytes_);
+    std::swap(names_, packed.names_);
+    std::swap(events_, packed.events_);
+    std::swap(nCollision_, packed.nCollision_);
+    free_.clear();
+    free_.shrink_to_fit();
+    return newOf;
+}
+
+// ***********************************************************************************************
+EvNameStore::Event EvNameStore::find(const HashedEvName& aEvName) const
+{
+    if (frozen_)
+    {
+        const auto event = phash_.at(aEvName.hash());
+        return event != PerfectHash::NOT_FOUND && names_[event] == aEvName.name() ? event : NOT_FOUND;
+    }
+    auto&& it = events_.find(aEvName);
+    return it == events_.end() ? NOT_FOUND : it->second;
+}
+
+// ***********************************************************************************************
+bool EvNameStore::freeze()
+{
+    if (frozen_) return true;
+
+    std::vector<size_t> hashes;
+    hashes.reserve(names_.size());
+    for (auto&& name : names_) hashes.push_back(HashedEvName::hashOf(name));
+    if (not phash_.build(hashes)) return false;
+
+    decltype(events_)().swap(events_);
+    names_.shrink_to_fit();
+    frozen_ = true;
+    return true;
+}
+
+// ***********************************************************************************************
+bool EvNameStore::load(const DominoSnapshot& aSnap)
+{
+    size_t nByte = 0;
+    size_t nEvent = 0;
+    const auto blob = aSnap.view<char>(DominoSnapshot::tagOf("name"), nByte);
+    const auto ends = aSnap.view<uint64_t>(DominoSnapshot::tagOf("nmEd"), nEvent);
+    if (blob == nullptr || ends == nullptr || not names_.empty()) return false;
+    for (size_t ev = 0; ev < nEvent; ++ev)
+        if (ends[ev] > nByte || (ev > 0 && ends[ev] < ends[ev - 1])) return false;
+
+    chunkSize_ = chunkUsed_ = nByte;
+    nChunkBytes_ += nByte;
+    chunks_.emplace_back(new char[nByte]);
+    if (nByte) std::memcpy(chunks_.back().get(), blob, nByte);
+    names_.reserve(nEvent);
+    for (size_t ev = 0; ev < nEvent; ++ev)
+    {
+        const auto begin = ev == 0 ? 0 : ends[ev - 1];
+        names_.emplace_back(chunks_.back().get() + begin, ends[ev] - begin);
+    }
+
+    frozen_ = aSnap.has(DominoSnapshot::tagOf("phSd"));
+    if (frozen_) return phash_.load(aSnap, nEvent);
+    events_.reserve(nEvent);
+    for (Event ev = 0; ev < nEvent; ++ev)
+    {
+        const HashedEvName key(names_[ev]);
+        if (not events_.emplace(key, ev).second) return false;  // dup EvName
+        nCollision_ += nSameHash(key);
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+size_t EvNameStore::nSameHash(const HashedEvName& aKey) const
+{
+    size_t nSame = 0;
+    auto&& bucket = events_.bucket(aKey);  // same hash must be in same bucket
+    for (auto&& it = events_.begin(bucket); it != events_.end(bucket); ++it)
+    {
+        if (it->first.name().data() != aKey.name().data() && it->first.hash() == aKey.hash()) ++nSame;
+    }
+    return nSame;
+}
+
+// ***********************************************************************************************
+size_t EvNameStore::nIndexBytes() const
+{
+    // unordered_map node = value + next ptr (no cached hash since Hasher is noexcept)
+    return phash_.nBytes() + events_.bucket_count() * sizeof(void*)
+        + events_.size() * (sizeof(decltype(events_)::value_type) + sizeof(void*));
+}
+
+// ***********************************************************************************************
+size_t EvNameStore::nNameBytes() const
+{
+    return nChunkBytes_ + chunks_.capacity() * sizeof(chunks_[0]) + names_.capacity() * sizeof(names_[0]);
+}
+
+// ***********************************************************************************************
+void EvNameStore::reserve(const size_t aNName, const size_t aNNameBytes)
+{
+    names_.reserve(aNName);
+    if (not frozen_) events_.reserve(aNName);
+    if (aNNameBytes <= chunkSize_ - chunkUsed_) return;
+
+    chunkSize_ = aNNameBytes;  // store() continues in it, then doubles as usual
+    chunks_.emplace_back(new char[chunkSize_]);
+    chunkUsed_ = 0;
+    nChunkBytes_ += chunkSize_;
+}
+
+// ***********************************************************************************************
+void EvNameStore::rm(const Event aEv)
+{
+    const HashedEvName key(names_[aEv]);
+    nCollision_ -= nSameHash(key);  // reverse of add()
+    events_.erase(key);
+    names_[aEv] = std::string_view();
+    free_.push_back(aEv);
+}
+
+// ***********************************************************************************************
+void EvNameStore::save(DominoSnapshot& aSnap) const
+{
+    std::string blob;
+    std::vector<uint64_t> ends;
+    ends.reserve(names_.size());
+    for (auto&& name : names_)
+    {
+        blob.append(name);
+        ends.push_back(blob.size());
+    }
+    aSnap.put(DominoSnapshot::tagOf("name"), blob);
+    aSnap.put(DominoSnapshot::tagOf("nmEd"), ends);
+    if (frozen_) phash_.save(aSnap);
+}
+
+// ***********************************************************************************************
+std::string_view EvNameStore::store(const std::string_view aName)
+{
+    if (chunks_.empty() || chunkUsed_ + aName.size() > chunkSize_)
+    {
+        const size_t nextSize = chunks_.empty() ? MIN_CHUNK : std::min(chunkSize_ * 2, MAX_CHUNK);
+        chunkSize_ = std::max(aName.size(), nextSize);
+        chunks_.emplace_back(new char[chunkSize_]);
+        chunkUsed_ = 0;
+        nChunkBytes_ += chunkSize_;
+    }
+    auto&& dst = chunks_.back().get() + chunkUsed_;
+    if (not aName.empty()) std::memcpy(dst, aName.data(), aName.size());
+    chunkUsed_ += aName.size();
+    return std::string_view(dst, aName.size());
+}
+
+// ***********************************************************************************************
+void EvNameStore::thaw()
+{
+    if (not frozen_) return;
+
+    frozen_ = false;
+    for (Event ev = 0; ev < names_.size(); ++ev)
+        if (not removed(ev)) events_.emplace(HashedEvName(names_[ev]), ev);
+    phash_.clear();
+}
+}  // namespace
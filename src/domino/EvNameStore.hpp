@@ -0,0 +1,90 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: Domino's EvName <-> Event index (Event = position of EvName)
+//   . each EvName is stored ONCE in chunks_ (arena); names_ & events_ only hold views into it
+//   . chunk never moves/frees till destruct, so views are stable
+// - 2 modes:
+//   . editable: events_ (unordered_map) for lookup
+//   . frozen:   PerfectHash for lookup (events_ released) - smaller & 1 probe; can't add EvName
+// - rm(): Event into free list, reused by next add(); its EvName stays in arena till compact()
+// - why arena: 100k+ long hierarchical EvNames (eg Yang xpath) were stored twice as std::string
+//   (+heap node each), a big part of resident mem
+// - core: chunks_, names_, events_/phash_
+// ***********************************************************************************************
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "DominoSnapshot.hpp"
+#include "HashedEvName.hpp"
+#include "PerfectHash.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+class EvNameStore
+{
+public:
+    using Event = size_t;
+    enum : size_t { NOT_FOUND = static_cast<size_t>(-1) };
+
+    EvNameStore() = default;
+    EvNameStore(const EvNameStore&);  // own arena, not share rhs's
+    EvNameStore& operator=(const EvNameStore&) = delete;
+
+    Event find(const HashedEvName&) const;  // NOT_FOUND if not exist
+    Event add(const HashedEvName&);         // caller ensures !find() & !frozen(); reuse rm()'s Event 1st
+    void  rm(const Event);                  // caller ensures valid & !frozen()
+    void  reserve(const size_t aNName, const size_t aNNameBytes);  // eg before bulk add(), 1 chunk for all
+    bool  removed(const Event aEv) const { return names_[aEv].data() == nullptr; }  // & not reused yet
+    std::string_view name(const Event aEv) const { return names_[aEv]; }  // aEv must valid
+
+    // [old event]=new event (NOT_FOUND if removed): renumber live EvNames densely (same order), &
+    // repack arena; caller ensures !frozen()
+    std::vector<Event> compact();
+
+    // snapshot: EvNames back to back (= arena) + [event]=end offset, + perfect hash if frozen
+    void save(DominoSnapshot&) const;  // caller ensures nFree() == 0
+    bool load(const DominoSnapshot&);  // into empty store, 1 chunk; frozen as saved, else index rebuilt
+
+    bool freeze();  // false if can't perfect-hash (eg hash collision), then stay editable
+    void thaw();
+    bool frozen() const { return frozen_; }
+
+    // -------------------------------------------------------------------------------------------
+    // misc:
+    size_t size() const { return names_.size(); }  // incl. removed
+    size_t nFree() const { return free_.size(); }
+    size_t nCollision() const { return nCollision_; }  // num of EvNames sharing hash w/ other
+    size_t nNameBytes() const;                         // arena + names_
+    size_t nIndexBytes() const;                        // events_ or phash_ (approximate)
+
+    static constexpr size_t MIN_CHUNK = 256;        // small Domino (most UT) stays small
+    static constexpr size_t MAX_CHUNK = 64 * 1024;  // double chunk size till this
+
+private:
+    std::string_view store(const std::string_view);  // cp into arena
+    size_t nSameHash(const HashedEvName&) const;     // num of other EvNames in events_ w/ same hash
+
+    // -------------------------------------------------------------------------------------------
+    std::vector<std::unique_ptr<char[]> > chunks_;  // arena: all evNames back to back
+    size_t chunkSize_ = 0;                          // of chunks_.back()
+    size_t chunkUsed_ = 0;                          // of chunks_.back()
+    size_t nChunkBytes_ = 0;                        // all chunks_
+
+    std::vector<std::string_view> names_;                                   // [event]=evName in arena, null=rm
+    std::unordered_map<HashedEvName, Event, HashedEvName::Hasher> events_;  // [evName]=event; editable only
+    PerfectHash phash_;                                                     // evName's hash -> event; frozen only
+    std::vector<Event> free_;                                               // rm()'s events to reuse
+
+    size_t nCollision_ = 0;
+    bool   frozen_     = false;
+};
+}  // namespace
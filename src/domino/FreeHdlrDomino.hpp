@@ -15,6 +15,7 @@
 #ifndef FREE_HDLR_DOMINO_HPP_
 #define FREE_HDLR_DOMINO_HPP_
 
+#include <memory>  // shared_ptr
 #include <vector>
 
 namespace RLib
@@ -24,38 +25,83 @@ template<class aDominoType>
 class FreeHdlrDomino : public aDominoType
 {
 public:
-    Domino::Event flagRepeatedHdlr(const Domino::EvName&);
-    bool isRepeatHdlr(const Domino::Event) const;
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
+    Event flagRepeatedHdlr(const Domino::EvName& aEvName) { return pureFlagRepeat(this->newEvent(aEvName)); }
+    Event flagRepeatedHdlr(const EventHandle aHdl) { return pureFlagRepeat(this->getEventBy(aHdl)); }
+    bool isRepeatHdlr(const Event) const;
 
 protected:
-    void triggerHdlr(const SharedMsgCB& aHdlr, const Domino::Event aEv) override;
+    void triggerHdlr(const SharedMsgCB& aHdlr, const Event aEv) override;
     using aDominoType::effect;
+    void forget(const Event aEv) override
+    {
+        if (isRepeatHdlr(aEv))
+        {
+            isRepeatHdlr_ = std::make_shared<RepeatFlags>(*isRepeatHdlr_);  // own 1st
+            (*isRepeatHdlr_)[aEv] = false;
+        }
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        isRepeatHdlr_ = std::make_shared<RepeatFlags>(*isRepeatHdlr_);
+        this->renumberVec(*isRepeatHdlr_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
+    void saveExt(DominoSnapshot& aSnap) const override
+    {
+        aSnap.put(DominoSnapshot::tagOf("rept"), *isRepeatHdlr_);
+        aDominoType::saveExt(aSnap);
+    }
+    bool loadExt(const DominoSnapshot& aSnap, const size_t aNEvent) override
+    {
+        RepeatFlags flags;
+        if (aSnap.get(DominoSnapshot::tagOf("rept"), flags))
+        {
+            if (flags.size() > aNEvent) return false;
+            isRepeatHdlr_ = std::make_shared<RepeatFlags>(std::move(flags));
+        }
+        return aDominoType::loadExt(aSnap, aNEvent);
+    }
+    void shareExt(const typename aDominoType::BasicDomino& aFrom) override  // + repeat flags
+    {
+        if (auto&& from = dynamic_cast<const FreeHdlrDomino*>(&aFrom)) isRepeatHdlr_ = from->isRepeatHdlr_;
+        aDominoType::shareExt(aFrom);
+    }
 private:
-    std::vector<bool> isRepeatHdlr_;  // bitmap & dyn expand, [event]=t/f
+    Event pureFlagRepeat(const Event);
+
+    using RepeatFlags = std::vector<bool>;
+    std::shared_ptr<RepeatFlags> isRepeatHdlr_ = std::make_shared<RepeatFlags>();  // [event]=t/f, dyn expand; COW
 public:
     using aDominoType::log_;
 };
 
 // ***********************************************************************************************
 template<class aDominoType>
-Domino::Event FreeHdlrDomino<aDominoType>::flagRepeatedHdlr(const Domino::EvName& aEvName)
+typename aDominoType::Event FreeHdlrDomino<aDominoType>::pureFlagRepeat(const Event aEv)
 {
-    auto&& event = this->newEvent(aEvName);
-    if (event >= isRepeatHdlr_.size()) isRepeatHdlr_.resize(event + 1);
-    isRepeatHdlr_[event] = true;
-    return event;
+    if (aEv == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
+
+    if (isRepeatHdlr_.use_count() > 1) isRepeatHdlr_ = std::make_shared<RepeatFlags>(*isRepeatHdlr_);  // own 1st
+    if (aEv >= isRepeatHdlr_->size()) isRepeatHdlr_->resize(aEv + 1);
+    (*isRepeatHdlr_)[aEv] = true;
+    return aEv;
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool FreeHdlrDomino<aDominoType>::isRepeatHdlr(const Domino::Event aEv) const
+bool FreeHdlrDomino<aDominoType>::isRepeatHdlr(const Event aEv) const
 {
-    return aEv < isRepeatHdlr_.size() ? isRepeatHdlr_.at(aEv) : false;
+    return aEv < isRepeatHdlr_->size() ? isRepeatHdlr_->at(aEv) : false;
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-void FreeHdlrDomino<aDominoType>::triggerHdlr(const SharedMsgCB& aHdlr, const Domino::Event aEv)
+void FreeHdlrDomino<aDominoType>::triggerHdlr(const SharedMsgCB& aHdlr, const Event aEv)
 {
     if (isRepeatHdlr(aEv)) aDominoType::triggerHdlr(aHdlr, aEv);
     else
@@ -70,7 +116,7 @@ void FreeHdlrDomino<aDominoType>::triggerHdlr(const SharedMsgCB& aHdlr, const Do
                 (*hdlr)();
 
             // req: rm hdlr
-            this->pureRmHdlrOK(aEv, hdlr);  // only *HdlrDomino owns shared hdlr, prove "this" available
+            if (hdlr) this->pureRmHdlrOK(aEv, hdlr);  // only *HdlrDomino owns shared hdlr, prove "this" available
 
             // req: rm superHdlr
             superHdlr.reset();
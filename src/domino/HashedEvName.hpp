@@ -0,0 +1,61 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: EvName + its hash, hash computed at compile time for literal (eg "a/b"_ev)
+//   . Domino's EvName index is keyed by it, so literal lookup = probe by precomputed hash
+//   . runtime EvName (EvNameView) computes the same hash once per call, as before
+// - why:
+//   * most EvNames are literals, no need to hash them again & again at runtime
+//   . constexpr FNV-1a: same result at compile & run time, stable across platforms/runs
+// - collision: different EvNames with same hash are still correct (operator== checks name) but
+//   slower, so Domino detects & warns at newEvent() (see Domino::nHashCollision())
+// ***********************************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace RLib
+{
+// ***********************************************************************************************
+class HashedEvName
+{
+public:
+    constexpr explicit HashedEvName(const std::string_view aName) : name_(aName), hash_(hashOf(aName)) {}
+
+    constexpr std::string_view name() const { return name_; }
+    constexpr size_t hash() const { return hash_; }
+    constexpr bool operator==(const HashedEvName& aRhs) const
+    {
+        return hash_ == aRhs.hash_ && name_ == aRhs.name_;  // hash 1st: mostly diff
+    }
+
+    static constexpr size_t hashOf(const std::string_view aName)  // FNV-1a 64bit
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (auto&& ch : aName) hash = (hash ^ uint8_t(ch)) * 1099511628211ull;
+        return size_t(hash);
+    }
+    struct Hasher  // for unordered_map: no rehash; noexcept so map needn't cache hash again
+    {
+        size_t operator()(const HashedEvName& aEvName) const noexcept { return aEvName.hash(); }
+    };
+
+private:
+    std::string_view name_;  // not own the str
+    size_t hash_;
+};
+
+// ***********************************************************************************************
+inline namespace literals
+{
+constexpr HashedEvName operator""_ev(const char* aName, const size_t aLen)
+{
+    return HashedEvName(std::string_view(aName, aLen));
+}
+}  // namespace literals
+}  // namespace
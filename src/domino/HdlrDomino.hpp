@@ -21,6 +21,7 @@
 #include <functional>
 #include <memory>  // for shared_ptr
 #include <unordered_map>
+#include <vector>
 
 #include "MsgSelf.hpp"
 
@@ -31,35 +32,68 @@ template<class aDominoType>
 class HdlrDomino : public aDominoType
 {
 public:
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
     HdlrDomino() { msgSelf_ = MSG_SELF; }  // default
     void setMsgSelf(std::shared_ptr<MsgSelf>& aMsgSelf) { msgSelf_ = aMsgSelf; }  // can replace default
 
-    Domino::Event setHdlr(const Domino::EvName&, const MsgCB&);
-    bool rmOneHdlrOK(const Domino::EvName& aEvName);
+    Event setHdlr(const Domino::EvName& aEvName, const MsgCB& aHdlr)
+    {
+        return pureSetHdlr(this->newEvent(aEvName), aHdlr);
+    }
+    Event setHdlr(const EventHandle aHdl, const MsgCB& aHdlr)
+    {
+        return pureSetHdlr(this->getEventBy(aHdl), aHdlr);
+    }
+    Event setHdlr(const HashedEvName& aEvName, const MsgCB& aHdlr)
+    {
+        return pureSetHdlr(this->newEvent(aEvName), aHdlr);
+    }
+    bool rmOneHdlrOK(const Domino::EvName& aEvName) { return pureRmHdlrOK(this->getEventBy(aEvName)); }
+    bool rmOneHdlrOK(const EventHandle aHdl) { return pureRmHdlrOK(this->getEventBy(aHdl)); }
+    bool rmOneHdlrOK(const HashedEvName& aEvName) { return pureRmHdlrOK(this->getEventBy(aEvName)); }
 
     // -------------------------------------------------------------------------------------------
     // - add a new ev=aAliasEN to store aHdlr (aAliasEN's true prev is aHostEN)
     // . pros: can FreeHdlrDomino::flagRepeatedHdlr() for each hdlr
     // . cons: the state of aHostEN & aAliasEN may not sync
     // -------------------------------------------------------------------------------------------
-    Domino::Event multiHdlrByAliasEv(const Domino::EvName& aAliasEN, const MsgCB& aHdlr,
+    Event multiHdlrByAliasEv(const Domino::EvName& aAliasEN, const MsgCB& aHdlr,
         const Domino::EvName& aHostEN);
 
-    virtual EMsgPriority getPriority(const Domino::Event) const { return EMsgPri_NORM; }
+    virtual EMsgPriority getPriority(const Event) const { return EMsgPri_NORM; }
 
 protected:
-    void effect(const Domino::Event) override;
-    virtual void triggerHdlr(const SharedMsgCB& aHdlr, const Domino::Event aEv)
+    void effect(const Event) override;
+    bool hasEffect(const Event aEv) const override { return hdlrs_.count(aEv) > 0; }
+    void forget(const Event aEv) override
+    {
+        hdlrs_.erase(aEv);  // on-road hdlr is weak so won't be called
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        this->renumberKeys(hdlrs_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
+    virtual void triggerHdlr(const SharedMsgCB& aHdlr, const Event aEv)
     {
-        msgSelf_->newMsg(aHdlr, getPriority(aEv));
+        this->trace(TraceRing::TRIGGER_HDLR, aEv);
+        if (this->journaled() || TraceRing::on()) msgSelf_->ownMsg(wrapHdlr(aHdlr, aEv), getPriority(aEv));
+        else msgSelf_->newMsg(aHdlr, getPriority(aEv));  // most
     }
-    virtual bool pureRmHdlrOK(const Domino::Event& aEv, const SharedMsgCB& aHdlr = SharedMsgCB());
+    virtual bool pureRmHdlrOK(const Event& aEv, const SharedMsgCB& aHdlr = SharedMsgCB());
 
-    size_t nHdlrRef(const Domino::Event) const;
+    size_t nHdlrRef(const Event) const;
 
 private:
+    Event pureSetHdlr(const Event, const MsgCB&);
+    SharedMsgCB wrapHdlr(const SharedMsgCB&, const Event);  // trace hdlr's run time (CritPath) & journal its done
+
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, SharedMsgCB> hdlrs_;
+    std::unordered_map<Event, SharedMsgCB> hdlrs_;
     std::shared_ptr<MsgSelf> msgSelf_;
 public:
     using aDominoType::log_;
@@ -67,7 +101,7 @@ public:
 
 // ***********************************************************************************************
 template<class aDominoType>
-void HdlrDomino<aDominoType>::effect(const Domino::Event aEv)
+void HdlrDomino<aDominoType>::effect(const Event aEv)
 {
     auto&& it = hdlrs_.find(aEv);
     if (it == hdlrs_.end()) return;
@@ -78,26 +112,45 @@ void HdlrDomino<aDominoType>::effect(const Domino::Event aEv)
 
 // ***********************************************************************************************
 template<class aDominoType>
-Domino::Event HdlrDomino<aDominoType>::multiHdlrByAliasEv(const Domino::EvName& aAliasEN,
+typename aDominoType::Event HdlrDomino<aDominoType>::multiHdlrByAliasEv(const Domino::EvName& aAliasEN,
     const MsgCB& aHdlr, const Domino::EvName& aHostEN)
 {
     auto&& event = this->setHdlr(aAliasEN, aHdlr);
-    if (event == Domino::D_EVENT_FAILED_RET) return Domino::D_EVENT_FAILED_RET;
+    if (event == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
 
     return this->setPrev(aAliasEN, {{aHostEN, true}});
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-size_t HdlrDomino<aDominoType>::nHdlrRef(const Domino::Event aEvent) const
+size_t HdlrDomino<aDominoType>::nHdlrRef(const Event aEvent) const
 {
     auto&& it = hdlrs_.find(aEvent);
-    return it == hdlrs_.end() ? Domino::D_EVENT_FAILED_RET : it->second.use_count();
+    return it == hdlrs_.end() ? D_EVENT_FAILED_RET : it->second.use_count();
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool HdlrDomino<aDominoType>::pureRmHdlrOK(const Domino::Event& aEv, const SharedMsgCB& aHdlr)
+SharedMsgCB HdlrDomino<aDominoType>::wrapHdlr(const SharedMsgCB& aHdlr, const Event aEv)
+{
+    // - 1 wrapper for both, owned by MsgSelf (ownMsg()) so freed even if never called
+    // - no this: may be called after this Domino destructed (then aHdlr expired & skipped anyway)
+    const auto noteDone = this->journaled() ? this->doneNote(aEv) : std::function<void()>();
+    return std::make_shared<MsgCB>([weakHdlr = WeakMsgCB(aHdlr), aEv, src = this->traceSrc(), noteDone]
+    {
+        auto&& hdlr = weakHdlr.lock();
+        if (not hdlr || not *hdlr) return;
+
+        TraceRing::record(TraceRing::HDLR_BEGIN, aEv, src);
+        (*hdlr)();
+        TraceRing::record(TraceRing::HDLR_END, aEv, src);
+        if (noteDone) noteDone();  // req: only after hdlr really done
+    });
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+bool HdlrDomino<aDominoType>::pureRmHdlrOK(const Event& aEv, const SharedMsgCB& aHdlr)
 {
     // req: "ret true" means real rm
     auto&& itHdlr = hdlrs_.find(aEv);
@@ -116,31 +169,26 @@ bool HdlrDomino<aDominoType>::pureRmHdlrOK(const Domino::Event& aEv, const Share
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool HdlrDomino<aDominoType>::rmOneHdlrOK(const Domino::EvName& aEvName)
+typename aDominoType::Event HdlrDomino<aDominoType>::pureSetHdlr(const Event aEv, const MsgCB& aHdlr)
 {
-    return pureRmHdlrOK(this->getEventBy(aEvName));
-}
+    if (aEv == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
 
-// ***********************************************************************************************
-template<class aDominoType>
-Domino::Event HdlrDomino<aDominoType>::setHdlr(const Domino::EvName& aEvName, const MsgCB& aHdlr)
-{
-    auto&& event = this->newEvent(aEvName);
-    if (hdlrs_.find(event) != hdlrs_.end())
+    if (hdlrs_.find(aEv) != hdlrs_.end())
     {
-        WRN("(HdlrDomino) Failed!!! Not support overwrite hdlr for " << aEvName << ". Use MultiHdlrDomino instead.");
-        return Domino::D_EVENT_FAILED_RET;
+        WRN("(HdlrDomino) Failed!!! Not support overwrite hdlr for " << this->evName(aEv)
+            << ". Use MultiHdlrDomino instead.");
+        return D_EVENT_FAILED_RET;
     }
     auto&& hdlr = std::make_shared<MsgCB>(aHdlr);
-    hdlrs_[event] = hdlr;
-    HID("(HdlrDomino) Succeed for EvName=" << aEvName);
+    hdlrs_[aEv] = hdlr;
+    HID("(HdlrDomino) Succeed for EvName=" << this->evName(aEv));
 
-    if (this->state(event) == true)
+    if (this->state(aEv) == true && not this->takeDone(aEv))  // req: not re-run hdlr done before crash
     {
-        DBG("(HdlrDomino) Trigger the new hdlr of EvName=" << aEvName);
-        triggerHdlr(hdlr, event);
+        DBG("(HdlrDomino) Trigger the new hdlr of EvName=" << this->evName(aEv));
+        triggerHdlr(hdlr, aEv);
     }
-    return event;
+    return aEv;
 }
 }  // namespace
 #endif  // HDLR_DOMINO_HPP_
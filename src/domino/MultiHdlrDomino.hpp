@@ -19,6 +19,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace RLib
 {
@@ -27,6 +28,10 @@ template<class aDominoType>
 class MultiHdlrDomino : public aDominoType
 {
 public:
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
     using HdlrName  = std::string;
     using MultiHdlr = std::map<HdlrName, SharedMsgCB>;
 
@@ -35,25 +40,57 @@ public:
     // . cons: can NOT FreeHdlrDomino::flagRepeatedHdlr() for each hdlr
     // . pros: 1 state, always sync
     // -------------------------------------------------------------------------------------------
-    Domino::Event multiHdlrOnSameEv(const Domino::EvName& aEvName, const MsgCB& aHdlr, const HdlrName& aHdlrName);
+    Event multiHdlrOnSameEv(const Domino::EvName& aEvName, const MsgCB& aHdlr, const HdlrName& aHdlrName)
+    {
+        return pureMultiHdlr(this->newEvent(aEvName), aHdlr, aHdlrName);
+    }
+    Event multiHdlrOnSameEv(const EventHandle aHdl, const MsgCB& aHdlr, const HdlrName& aHdlrName)
+    {
+        return pureMultiHdlr(this->getEventBy(aHdl), aHdlr, aHdlrName);
+    }
 
     using aDominoType::rmOneHdlrOK;
-    bool rmOneHdlrOK(const Domino::EvName& aEvName, const HdlrName& aHdlrName);
+    bool rmOneHdlrOK(const Domino::EvName& aEvName, const HdlrName& aHdlrName)
+    {
+        return pureRmOneHdlrOK(this->getEventBy(aEvName), aHdlrName);
+    }
+    bool rmOneHdlrOK(const EventHandle aHdl, const HdlrName& aHdlrName)
+    {
+        return pureRmOneHdlrOK(this->getEventBy(aHdl), aHdlrName);
+    }
 
 protected:
-    void effect(const Domino::Event) override;  // key/min change other Dominos
-    bool pureRmHdlrOK(const Domino::Event& aEv, const SharedMsgCB& aHdlr) override;
+    void effect(const Event) override;  // key/min change other Dominos
+    bool hasEffect(const Event aEv) const override
+    {
+        auto&& itEv = multiHdlrs_.find(aEv);
+        return (itEv != multiHdlrs_.end() && not itEv->second.empty()) || aDominoType::hasEffect(aEv);
+    }
+    bool pureRmHdlrOK(const Event& aEv, const SharedMsgCB& aHdlr) override;
+    void forget(const Event aEv) override
+    {
+        multiHdlrs_.erase(aEv);
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        this->renumberKeys(multiHdlrs_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
 
 private:
+    Event pureMultiHdlr(const Event, const MsgCB& aHdlr, const HdlrName& aHdlrName);
+    bool pureRmOneHdlrOK(const Event, const HdlrName& aHdlrName);
+
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, MultiHdlr> multiHdlrs_;
+    std::unordered_map<Event, MultiHdlr> multiHdlrs_;
 public:
     using aDominoType::log_;
 };
 
 // ***********************************************************************************************
 template<class aDominoType>
-void MultiHdlrDomino<aDominoType>::effect(const Domino::Event aEv)
+void MultiHdlrDomino<aDominoType>::effect(const Event aEv)
 {
     aDominoType::effect(aEv);
 
@@ -71,39 +108,39 @@ void MultiHdlrDomino<aDominoType>::effect(const Domino::Event aEv)
 
 // ***********************************************************************************************
 template<class aDominoType>
-Domino::Event MultiHdlrDomino<aDominoType>::multiHdlrOnSameEv(const Domino::EvName& aEvName,
+typename aDominoType::Event MultiHdlrDomino<aDominoType>::pureMultiHdlr(const Event aEv,
     const MsgCB& aHdlr, const HdlrName& aHdlrName)
 {
-    auto&& hdlr = std::make_shared<MsgCB>(aHdlr);
+    if (aEv == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
 
-    auto&& event = this->newEvent(aEvName);
-    auto&& itEv = multiHdlrs_.find(event);
+    auto&& hdlr = std::make_shared<MsgCB>(aHdlr);
+    auto&& itEv = multiHdlrs_.find(aEv);
     if (itEv == multiHdlrs_.end())
-        multiHdlrs_[event][aHdlrName] = hdlr;
+        multiHdlrs_[aEv][aHdlrName] = hdlr;
     else
     {
         auto&& itHdlr = itEv->second.find(aHdlrName);
         if (itHdlr != itEv->second.end())
         {
-            WRN("(MultiHdlrDomino)!!! Failed since dup EvName=" << aEvName << " + HdlrName=" << aHdlrName);
-            return Domino::D_EVENT_FAILED_RET;
+            WRN("(MultiHdlrDomino)!!! Failed since dup EvName=" << this->evName(aEv) << " + HdlrName=" << aHdlrName);
+            return D_EVENT_FAILED_RET;
         }
         itEv->second[aHdlrName] = hdlr;
     }
-    HID("(MultiHdlrDomino) Succeed for EvName=" << aEvName << ", HdlrName=" << aHdlrName);
+    HID("(MultiHdlrDomino) Succeed for EvName=" << this->evName(aEv) << ", HdlrName=" << aHdlrName);
 
-    if (this->state(event))
+    if (this->state(aEv) && not this->takeDone(aEv))  // req: not re-run hdlr done before crash
     {
-        DBG("(MultiHdlrDomino) Trigger the new hdlr=" << aHdlrName << "of EvName=" << aEvName);
-        this->triggerHdlr(hdlr, event);
+        DBG("(MultiHdlrDomino) Trigger the new hdlr=" << aHdlrName << "of EvName=" << this->evName(aEv));
+        this->triggerHdlr(hdlr, aEv);
     }
 
-    return event;
+    return aEv;
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool MultiHdlrDomino<aDominoType>::pureRmHdlrOK(const Domino::Event& aEv, const SharedMsgCB& aHdlr)
+bool MultiHdlrDomino<aDominoType>::pureRmHdlrOK(const Event& aEv, const SharedMsgCB& aHdlr)
 {
     const auto isRmOK = aDominoType::pureRmHdlrOK(aEv, aHdlr);
     if (isRmOK || not aHdlr)
@@ -129,12 +166,12 @@ bool MultiHdlrDomino<aDominoType>::pureRmHdlrOK(const Domino::Event& aEv, const
 
 // ***********************************************************************************************
 template<class aDominoType>
-bool MultiHdlrDomino<aDominoType>::rmOneHdlrOK(const Domino::EvName& aEvName, const HdlrName& aHdlrName)
+bool MultiHdlrDomino<aDominoType>::pureRmOneHdlrOK(const Event aEv, const HdlrName& aHdlrName)
 {
-    auto&& itEv = multiHdlrs_.find(this->getEventBy(aEvName));
+    auto&& itEv = multiHdlrs_.find(aEv);
     if (itEv == multiHdlrs_.end()) return false;
 
-    DBG("(MultiHdlrDomino) Succeed to remove HdlrName=" << aHdlrName << " of EvName=" << aEvName);
+    DBG("(MultiHdlrDomino) Succeed to remove HdlrName=" << aHdlrName << " of EvName=" << this->evName(aEv));
     return itEv->second.erase(aHdlrName);
 }
 }  // namespace
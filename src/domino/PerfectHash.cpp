@@ -0,0 +1,110 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+
+#include "PerfectHash.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+size_t PerfectHash::at(const size_t aHash) const
+{
+    if (slots_.empty()) return NOT_FOUND;
+    return slots_[slotOf(aHash, seeds_[bucketOf(aHash)])];
+}
+
+// ***********************************************************************************************
+bool PerfectHash::build(const std::vector<size_t>& aHashes)
+{
+    clear();
+    const auto nKey = aHashes.size();
+    if (nKey == 0) return true;
+
+    auto sorted = aHashes;
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) return false;  // dup hash
+
+    seeds_.assign(nKey / 4 + 1, 0);            // avg 4 keys/bucket
+    slots_.assign(nKey + nKey / 8 + 1, NOT_FOUND);  // ~90% load
+    std::vector<std::vector<size_t> > buckets(seeds_.size());
+    for (size_t idx = 0; idx < nKey; ++idx) buckets[bucketOf(aHashes[idx])].push_back(idx);
+
+    std::vector<size_t> order(buckets.size());  // biggest bucket 1st while most slots free
+    for (size_t bucket = 0; bucket < order.size(); ++bucket) order[bucket] = bucket;
+    std::stable_sort(order.begin(), order.end(),
+        [&buckets](const size_t aL, const size_t aR) { return buckets[aL].size() > buckets[aR].size(); });
+
+    std::vector<size_t> tried;
+    for (auto&& bucket : order)
+    {
+        auto&& keys = buckets[bucket];
+        if (keys.empty()) break;
+
+        uint32_t seed = 0;
+        for (; seed < MAX_SEED; ++seed)
+        {
+            tried.clear();
+            for (auto&& idx : keys)
+            {
+                const auto slot = slotOf(aHashes[idx], seed);
+                if (slots_[slot] != NOT_FOUND || std::find(tried.begin(), tried.end(), slot) != tried.end()) break;
+                tried.push_back(slot);
+            }
+            if (tried.size() == keys.size()) break;
+        }
+        if (seed == MAX_SEED)
+        {
+            clear();
+            return false;
+        }
+        seeds_[bucket] = seed;
+        for (size_t i = 0; i < keys.size(); ++i) slots_[tried[i]] = keys[i];
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+void PerfectHash::clear()
+{
+    std::vector<uint32_t>().swap(seeds_);
+    std::vector<size_t>().swap(slots_);
+}
+
+// ***********************************************************************************************
+bool PerfectHash::load(const DominoSnapshot& aSnap, const size_t aNKey)
+{
+    if (not aSnap.get(DominoSnapshot::tagOf("phSd"), seeds_) || not aSnap.get(DominoSnapshot::tagOf("phSl"), slots_)
+        || seeds_.empty() != slots_.empty())
+    {
+        clear();
+        return false;
+    }
+    for (auto&& slot : slots_)
+    {
+        if (slot != NOT_FOUND && slot >= aNKey)
+        {
+            clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+// ***********************************************************************************************
+size_t PerfectHash::mix(uint64_t aHash)
+{
+    aHash = (aHash ^ (aHash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    aHash = (aHash ^ (aHash >> 27)) * 0x94D049BB133111EBull;
+    return size_t(aHash ^ (aHash >> 31));
+}
+// ***********************************************************************************************
+void PerfectHash::save(DominoSnapshot& aSnap) const
+{
+    aSnap.put(DominoSnapshot::tagOf("phSd"), seeds_);
+    aSnap.put(DominoSnapshot::tagOf("phSl"), slots_);
+}
+}  // namespace
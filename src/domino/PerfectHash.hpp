@@ -0,0 +1,52 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: static perfect hash (hash & displace) from a fixed key set's hashes to their index
+//   . keys grouped into buckets by hash; each bucket gets a seed so all its keys land in free slots
+//   . lookup = 2 array reads, no chain/probe; caller verifies the key (non-key may hit any slot)
+// - why: Domino::freeze() - EvName set is fixed after setup, lookup is the hot path
+// - limit: keys with the same hash can't be separated, build() fails (caller keeps its own map)
+// - core: seeds_, slots_
+// ***********************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "DominoSnapshot.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+class PerfectHash
+{
+public:
+    enum : size_t { NOT_FOUND = static_cast<size_t>(-1) };
+
+    bool   build(const std::vector<size_t>& aHashes);  // index = position in aHashes
+    size_t at(const size_t aHash) const;               // candidate index or NOT_FOUND; caller to verify
+
+    void   clear();
+    void   save(DominoSnapshot&) const;                  // seeds & slots as is, no rebuild
+    bool   load(const DominoSnapshot&, const size_t aNKey);  // false if absent or bad
+    bool   empty() const { return slots_.empty(); }
+    size_t nBytes() const { return seeds_.capacity() * sizeof(uint32_t) + slots_.capacity() * sizeof(size_t); }
+
+    enum { MAX_SEED = 1 << 16 };  // give up build() beyond (practically never for distinct hashes)
+
+private:
+    static size_t mix(uint64_t aHash);  // splitmix64 finalizer: spread FNV's weak low bits
+    size_t bucketOf(const size_t aHash) const { return mix(aHash) % seeds_.size(); }
+    size_t slotOf(const size_t aHash, const uint32_t aSeed) const
+    {
+        return mix(aHash ^ ((aSeed + 1) * 0x9E3779B97F4A7C15ull)) % slots_.size();
+    }
+
+    // -------------------------------------------------------------------------------------------
+    std::vector<uint32_t> seeds_;  // [bucket]=seed
+    std::vector<size_t>   slots_;  // [slot]=index of key, NOT_FOUND if empty
+};
+}  // namespace
@@ -13,7 +13,9 @@
 #ifndef PRI_DOMINO_HPP_
 #define PRI_DOMINO_HPP_
 
+#include <memory>  // shared_ptr
 #include <unordered_map>
+#include <vector>
 
 namespace RLib
 {
@@ -22,37 +24,113 @@ template<class aDominoType>
 class PriDomino : public aDominoType
 {
 public:
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
     // -------------------------------------------------------------------------------------------
     // Extend Tile record:
     // - priority: Tile's priority to call hdlr, optional
     // -------------------------------------------------------------------------------------------
-    EMsgPriority  getPriority(const Domino::Event) const override;  // key/min change other Dominos
-    Domino::Event setPriority(const Domino::EvName&, const EMsgPriority);
+    EMsgPriority  getPriority(const Event) const override;  // key/min change other Dominos
+    Event setPriority(const Domino::EvName& aEvName, const EMsgPriority aPri)
+    {
+        return pureSetPriority(this->newEvent(aEvName), aPri);
+    }
+    Event setPriority(const EventHandle aHdl, const EMsgPriority aPri)
+    {
+        return pureSetPriority(this->getEventBy(aHdl), aPri);
+    }
+
+protected:
+    void forget(const Event aEv) override
+    {
+        if (priorities_->count(aEv)) pureSetPriority(aEv, EMsgPri_NORM);
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        priorities_ = std::make_shared<Priorities>(*priorities_);  // own 1st
+        this->renumberKeys(*priorities_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
+    void saveExt(DominoSnapshot&) const override;
+    bool loadExt(const DominoSnapshot&, const size_t aNEvent) override;
+    void shareExt(const typename aDominoType::BasicDomino& aFrom) override;  // + priorities
 
 private:
+    Event pureSetPriority(const Event, const EMsgPriority);
+
     // -------------------------------------------------------------------------------------------
-    std::unordered_map<Domino::Event, EMsgPriority> priorities_;   // [event]=priority
+    using Priorities = std::unordered_map<Event, EMsgPriority>;
+    std::shared_ptr<Priorities> priorities_ = std::make_shared<Priorities>();  // [event]=priority; COW
 public:
     using aDominoType::log_;
 };
 
 // ***********************************************************************************************
 template<class aDominoType>
-EMsgPriority PriDomino<aDominoType>::getPriority(const Domino::Event aEv) const
+EMsgPriority PriDomino<aDominoType>::getPriority(const Event aEv) const
+{
+    auto&& it = priorities_->find(aEv);
+    return it == priorities_->end() ? EMsgPri_NORM : it->second;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+bool PriDomino<aDominoType>::loadExt(const DominoSnapshot& aSnap, const size_t aNEvent)
+{
+    std::vector<Event> evs;
+    std::vector<uint8_t> pris;
+    if (aSnap.get(DominoSnapshot::tagOf("priE"), evs))
+    {
+        if (not aSnap.get(DominoSnapshot::tagOf("priV"), pris, evs.size())) return false;
+        auto&& priorities = std::make_shared<Priorities>();
+        for (size_t idx = 0; idx < evs.size(); ++idx)
+        {
+            if (evs[idx] >= aNEvent || pris[idx] >= EMsgPri_MAX) return false;
+            priorities->emplace(evs[idx], EMsgPriority(pris[idx]));
+        }
+        priorities_ = priorities;
+    }
+    return aDominoType::loadExt(aSnap, aNEvent);
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+typename aDominoType::Event PriDomino<aDominoType>::pureSetPriority(const Event aEv, const EMsgPriority aPri)
+{
+    if (aEv == D_EVENT_FAILED_RET) return D_EVENT_FAILED_RET;
+
+    DBG("(PriDomino) EvName=" << this->evName(aEv) << ", newPri=" << aPri);
+    if (priorities_.use_count() > 1) priorities_ = std::make_shared<Priorities>(*priorities_);  // own 1st
+    if (aPri == EMsgPri_NORM) priorities_->erase(aEv);  // less mem & faster searching
+    else (*priorities_)[aEv] = aPri;
+    return aEv;
+}
+
+// ***********************************************************************************************
+template<class aDominoType>
+void PriDomino<aDominoType>::saveExt(DominoSnapshot& aSnap) const
 {
-    auto&& it = priorities_.find(aEv);
-    return it == priorities_.end() ? EMsgPri_NORM : it->second;
+    std::vector<Event> evs;
+    std::vector<uint8_t> pris;
+    for (auto&& it : *priorities_)
+    {
+        evs.push_back(it.first);
+        pris.push_back(uint8_t(it.second));
+    }
+    aSnap.put(DominoSnapshot::tagOf("priE"), evs);
+    aSnap.put(DominoSnapshot::tagOf("priV"), pris);
+    aDominoType::saveExt(aSnap);
 }
 
 // ***********************************************************************************************
 template<class aDominoType>
-Domino::Event PriDomino<aDominoType>::setPriority(const Domino::EvName& aEvName, const EMsgPriority aPri)
+void PriDomino<aDominoType>::shareExt(const typename aDominoType::BasicDomino& aFrom)
 {
-    DBG("(PriDomino) EvName=" << aEvName << ", newPri=" << aPri);
-    auto&& event = this->newEvent(aEvName);
-    if (aPri == EMsgPri_NORM) priorities_.erase(event);  // less mem & faster searching
-    else priorities_[event] = aPri;
-    return event;
+    if (auto&& from = dynamic_cast<const PriDomino*>(&aFrom)) priorities_ = from->priorities_;
+    aDominoType::shareExt(aFrom);
 }
 }  // namespace
 #endif  // PRI_DOMINO_HPP_
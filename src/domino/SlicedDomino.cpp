@@ -0,0 +1,295 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>
+#include <bitset>
+#include <functional>  // greater
+
+#include "SlicedDomino.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aEvent>
+BasicSlicedDomino<aEvent>::BasicSlicedDomino(const BasicDomino<aEvent>& aTopo, const size_t aNInst)
+    : nInst_(aNInst)
+    , nEvent_(aTopo.nEvent())
+    , nWord_((aNInst + N_INST_PER_WORD - 1) / N_INST_PER_WORD)
+    , order_(aTopo.topoOrder())
+    , pos_(nEvent_)
+    , topo_(aTopo.topo_)
+    , states_(nEvent_ * nWord_)
+    , touched_(nEvent_ * nWord_)
+    , isTouched_(nEvent_)
+    , isDirty_(nEvent_)
+    , sat_(nWord_)
+    , trig_(nWord_)
+    , log_(aTopo.log_.prefix_ + "-sliced")
+{
+    for (size_t idx = 0; idx < order_.size(); ++idx) pos_[order_[idx]] = idx;  // all events (Domino has no loop)
+
+    prevBegin_.reserve(nEvent_ + 1);
+    nextBegin_.reserve(nEvent_ + 1);
+    for (Event ev = 0; ev < nEvent_; ++ev)
+    {
+        prevBegin_.push_back(prevs_.size());
+        for (size_t idx = 0, nPrev = topo_->prev_.degree(ev); idx < nPrev; ++idx)
+            prevs_.push_back(topo_->prev_.at(ev, idx));  // same (node << 1) | flag as EdgeCsr
+
+        nextBegin_.push_back(nexts_.size());
+        for (size_t idx = 0, nNext = topo_->next_.degree(ev); idx < nNext; ++idx)
+            nexts_.push_back(BasicEdgeCsr<aEvent>::nodeOf(topo_->next_.at(ev, idx)));
+    }
+    prevBegin_.push_back(prevs_.size());
+    nextBegin_.push_back(nexts_.size());
+
+    const auto allInsts = this->allInsts();
+    for (Event ev = 0; ev < nEvent_; ++ev)
+    {
+        if (aTopo.states_[ev]) std::copy(allInsts.begin(), allInsts.end(), &states_[ev * nWord_]);
+    }
+    HID("Succeed, nEvent=" << nEvent_ << ", nEdge=" << prevs_.size() << ", nInst=" << nInst_);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicSlicedDomino<aEvent>::Insts BasicSlicedDomino<aEvent>::allInsts() const
+{
+    Insts insts(nWord_, ~Word(0));
+    if (nInst_ % N_INST_PER_WORD) insts.back() = (Word(1) << (nInst_ % N_INST_PER_WORD)) - 1;
+    return insts;
+}
+
+// ***********************************************************************************************
+// - dirty_ by topological pos, so an event is deduced once after all its prevs settled
+// - only words touched in this pass are computed ([wBegin_, wEnd_))
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::deduce()
+{
+    const std::greater<size_t> minHeap;
+    while (not dirty_.empty())
+    {
+        std::pop_heap(dirty_.begin(), dirty_.end(), minHeap);
+        const auto ev = order_[dirty_.back()];
+        dirty_.pop_back();
+        isDirty_[ev] = false;
+
+        const auto need = topo_->need_[ev];  // 0=AND, 1=OR, else k-of-n (see Domino::setNeed())
+        std::fill(sat_.begin() + wBegin_, sat_.begin() + wEnd_, need == 0 ? ~Word(0) : 0);
+        std::fill(trig_.begin() + wBegin_, trig_.begin() + wEnd_, 0);
+        if (need > 1)
+        {
+            nSat_.resize(nWord_ * N_INST_PER_WORD);  // only if any k-of-n tile
+            std::fill(nSat_.begin() + wBegin_ * N_INST_PER_WORD, nSat_.begin() + wEnd_ * N_INST_PER_WORD, 0);
+        }
+        for (auto idx = prevBegin_[ev]; idx < prevBegin_[ev + 1]; ++idx)
+        {
+            const auto prevEv = BasicEdgeCsr<aEvent>::nodeOf(prevs_[idx]);
+            const Word flip = BasicEdgeCsr<aEvent>::flagOf(prevs_[idx]) ? 0 : ~Word(0);
+            const auto states = &states_[prevEv * nWord_];
+            const auto touched = &touched_[prevEv * nWord_];
+            for (auto w = wBegin_; w < wEnd_; ++w)  // vectorizable
+            {
+                const auto satisfied = states[w] ^ flip;
+                if (need == 0) sat_[w] &= satisfied;
+                else if (need == 1) sat_[w] |= satisfied;
+                else countSat(w, satisfied);
+                trig_[w] |= touched[w] & satisfied;  // = Domino's pushNext() of a prev
+            }
+        }
+        if (need > 1)
+        {
+            for (auto w = wBegin_; w < wEnd_; ++w)
+                for (size_t bit = 0; bit < N_INST_PER_WORD; ++bit)
+                    if (nSat_[w * N_INST_PER_WORD + bit] >= need) sat_[w] |= Word(1) << bit;
+        }
+
+        bool fired = false;
+        for (auto w = wBegin_; w < wEnd_; ++w)
+        {
+            const auto fire = sat_[w] & trig_[w];  // re-fire if already true, like Domino
+            if (fire == 0) continue;
+
+            word(states_, ev, w) |= fire;
+            word(touched_, ev, w) |= fire;
+            fired = true;
+        }
+        if (fired)
+        {
+            touch(ev);
+            markNext(ev);
+        }
+    }
+
+    for (auto&& ev : touchedEvs_)
+    {
+        isTouched_[ev] = false;
+        std::fill(&touched_[ev * nWord_] + wBegin_, &touched_[ev * nWord_] + wEnd_, 0);
+    }
+    touchedEvs_.clear();
+    wBegin_ = wEnd_ = 0;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::countSat(const size_t aW, Word aSatisfied)
+{
+    for (size_t bit = 0; aSatisfied; ++bit, aSatisfied >>= 1) nSat_[aW * N_INST_PER_WORD + bit] += aSatisfied & 1;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicSlicedDomino<aEvent>::Event BasicSlicedDomino<aEvent>::getEventBy(const EvNameView aEvName) const
+{
+    const auto event = topo_->evNames_.find(HashedEvName(aEvName));
+    return event == EvNameStore::NOT_FOUND ? D_EVENT_FAILED_RET : Event(event);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::markNext(const Event aEv)
+{
+    for (auto idx = nextBegin_[aEv]; idx < nextBegin_[aEv + 1]; ++idx)
+    {
+        const auto nextEv = nexts_[idx];
+        if (isDirty_[nextEv]) continue;
+
+        isDirty_[nextEv] = true;
+        dirty_.push_back(pos_[nextEv]);
+        std::push_heap(dirty_.begin(), dirty_.end(), std::greater<size_t>());
+    }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+size_t BasicSlicedDomino<aEvent>::nBytes() const
+{
+    return (states_.capacity() + touched_.capacity()) * sizeof(Word)
+        + (order_.capacity() + prevs_.capacity() + nexts_.capacity() + nSat_.capacity()) * sizeof(Event)
+        + (pos_.capacity() + prevBegin_.capacity() + nextBegin_.capacity()) * sizeof(size_t)
+        + topo_->evNames_.nNameBytes() + topo_->evNames_.nIndexBytes();  // shared w/ aTopo
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+size_t BasicSlicedDomino<aEvent>::nTrue(const EvNameView aEvName) const
+{
+    const auto ev = getEventBy(aEvName);
+    if (ev == D_EVENT_FAILED_RET) return 0;
+
+    size_t nTrue = 0;
+    for (size_t w = 0; w < nWord_; ++w) nTrue += std::bitset<N_INST_PER_WORD>(word(states_, ev, w)).count();
+    return nTrue;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::pureSet(const Event aEv, const bool aState, const size_t aW, const Word aBits)
+{
+    auto&& states = word(states_, aEv, aW);
+    states = aState ? (states | aBits) : (states & ~aBits);
+    word(touched_, aEv, aW) |= aBits;
+    touch(aEv);
+    markNext(aEv);
+
+    if (wBegin_ == wEnd_)
+    {
+        wBegin_ = aW;
+        wEnd_ = aW + 1;
+    }
+    else
+    {
+        wBegin_ = std::min(wBegin_, aW);
+        wEnd_ = std::max(wEnd_, aW + 1);
+    }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::setState(const size_t aInst, const SimuEvNames aSimuEvents)
+{
+    if (aInst >= nInst_)
+    {
+        WRN("!!!Failed, invalid inst=" << aInst << ", nInst=" << nInst_);
+        return;
+    }
+    for (auto&& itSim : aSimuEvents)
+    {
+        const auto ev = getEventBy(itSim.first);
+        if (ev == D_EVENT_FAILED_RET)
+        {
+            WRN("!!!Failed, unknown EvName=" << itSim.first);
+            continue;
+        }
+        pureSet(ev, itSim.second, aInst / N_INST_PER_WORD, bitOf(aInst));
+    }
+    deduce();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::setState(const Insts& aInsts, const SimuEvNames aSimuEvents)
+{
+    if (aInsts.size() != nWord_)
+    {
+        WRN("!!!Failed, Insts has " << aInsts.size() << " words, expect " << nWord_);
+        return;
+    }
+    const auto allInsts = this->allInsts();
+    for (auto&& itSim : aSimuEvents)
+    {
+        const auto ev = getEventBy(itSim.first);
+        if (ev == D_EVENT_FAILED_RET)
+        {
+            WRN("!!!Failed, unknown EvName=" << itSim.first);
+            continue;
+        }
+        for (size_t w = 0; w < nWord_; ++w)
+            if (aInsts[w] & allInsts[w]) pureSet(ev, itSim.second, w, aInsts[w] & allInsts[w]);
+    }
+    deduce();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::setState(const InstEvents& aInstEvents)
+{
+    for (auto&& instEv : aInstEvents)
+    {
+        const auto ev = getEventBy(instEv.evName);
+        if (ev == D_EVENT_FAILED_RET || instEv.inst >= nInst_)
+        {
+            WRN("!!!Failed, unknown EvName=" << instEv.evName << " or invalid inst=" << instEv.inst);
+            continue;
+        }
+        pureSet(ev, instEv.state, instEv.inst / N_INST_PER_WORD, bitOf(instEv.inst));
+    }
+    deduce();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicSlicedDomino<aEvent>::state(const size_t aInst, const EvNameView aEvName) const
+{
+    const auto ev = getEventBy(aEvName);
+    if (ev == D_EVENT_FAILED_RET || aInst >= nInst_) return false;
+    return word(states_, ev, aInst / N_INST_PER_WORD) & bitOf(aInst);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicSlicedDomino<aEvent>::touch(const Event aEv)
+{
+    if (isTouched_[aEv]) return;
+
+    isTouched_[aEv] = true;
+    touchedEvs_.push_back(aEv);
+}
+
+template class BasicSlicedDomino<uint16_t>;
+template class BasicSlicedDomino<uint32_t>;
+template class BasicSlicedDomino<size_t>;
+}  // namespace
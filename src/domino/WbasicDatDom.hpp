@@ -17,16 +17,67 @@ template<typename aDominoType>
 class WbasicDatDom : public aDominoType
 {
 public:
-    bool isWrCtrl(const Domino::EvName&) const;
+    using typename aDominoType::Event;
+    using typename aDominoType::EventHandle;
+    using aDominoType::D_EVENT_FAILED_RET;
+
+    bool isWrCtrl(const Domino::EvName& aEvName) const { return pureIsWrCtrl(this->getEventBy(aEvName)); }
+    bool isWrCtrl(const EventHandle aHdl) const { return pureIsWrCtrl(this->getEventBy(aHdl)); }
     bool wrCtrlOk(const Domino::EvName&);
+    bool wrCtrlOk(const EventHandle);
+    bool isWrCtrl(const HashedEvName& aEvName) const { return pureIsWrCtrl(this->getEventBy(aEvName)); }
+    bool wrCtrlOk(const HashedEvName& aEvName) { return wrCtrlOk(this->newHandle(aEvName)); }
 
     std::shared_ptr<void> getShared(const Domino::EvName& aEvName) override;
+    std::shared_ptr<void> getShared(const EventHandle aHdl) override;
     std::shared_ptr<void> wbasic_getShared(const Domino::EvName& aEvName);
+    std::shared_ptr<void> wbasic_getShared(const EventHandle aHdl);
+    std::shared_ptr<void> getShared(const HashedEvName& aEvName) { return getShared(this->newHandle(aEvName)); }
+    std::shared_ptr<void> wbasic_getShared(const HashedEvName& aEvName)
+    {
+        return wbasic_getShared(this->newHandle(aEvName));
+    }
 
     void replaceShared(const Domino::EvName& aEvName, std::shared_ptr<void> aSharedData) override;
+    void replaceShared(const EventHandle aHdl, std::shared_ptr<void> aSharedData) override;
     void wbasic_replaceShared(const Domino::EvName& aEvName, std::shared_ptr<void> aSharedData);
+    void wbasic_replaceShared(const EventHandle aHdl, std::shared_ptr<void> aSharedData);
+    void replaceShared(const HashedEvName& aEvName, std::shared_ptr<void> aSharedData)
+    {
+        replaceShared(this->newHandle(aEvName), aSharedData);
+    }
+    void wbasic_replaceShared(const HashedEvName& aEvName, std::shared_ptr<void> aSharedData)
+    {
+        wbasic_replaceShared(this->newHandle(aEvName), aSharedData);
+    }
+
+protected:
+    void forget(const Event aEv) override
+    {
+        if (pureIsWrCtrl(aEv)) wrCtrl_[aEv] = false;
+        aDominoType::forget(aEv);
+    }
+    void renumber(const std::vector<Event>& aNewOf) override
+    {
+        this->renumberVec(wrCtrl_, aNewOf);
+        aDominoType::renumber(aNewOf);
+    }
+    void saveExt(DominoSnapshot& aSnap) const override
+    {
+        aSnap.put(DominoSnapshot::tagOf("wrCt"), wrCtrl_);
+        aDominoType::saveExt(aSnap);
+    }
+    bool loadExt(const DominoSnapshot& aSnap, const size_t aNEvent) override
+    {
+        if (aSnap.has(DominoSnapshot::tagOf("wrCt"))
+            && (not aSnap.get(DominoSnapshot::tagOf("wrCt"), wrCtrl_) || wrCtrl_.size() > aNEvent)) return false;
+        return aDominoType::loadExt(aSnap, aNEvent);
+    }
 
 private:
+    bool pureIsWrCtrl(const Event aEv) const { return aEv < wrCtrl_.size() ? wrCtrl_.at(aEv) : false; }
+    bool pureWrCtrlOk(const Event aEv, const size_t aNShared);
+
     // forbid ouside usage
     using aDominoType::getShared;
     using aDominoType::replaceShared;
@@ -46,13 +97,13 @@ std::shared_ptr<void> WbasicDatDom<aDominoType>::getShared(const Domino::EvName&
     WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName << " is not write-protect so unavailable via this func!!!");
     return std::shared_ptr<void>();
 }
-
-// ***********************************************************************************************
 template<typename aDominoType>
-bool WbasicDatDom<aDominoType>::isWrCtrl(const Domino::EvName& aEvName) const
+std::shared_ptr<void> WbasicDatDom<aDominoType>::getShared(const EventHandle aHdl)
 {
-    const auto ev = this->getEventBy(aEvName);
-    return ev < wrCtrl_.size() ? wrCtrl_.at(ev) : false;
+    if (not isWrCtrl(aHdl)) return aDominoType::getShared(aHdl);
+
+    WRN("(WbasicDatDom) Failed!!! event=" << aHdl.event() << " is not write-protect so unavailable via this func!!!");
+    return std::shared_ptr<void>();
 }
 
 // ***********************************************************************************************
@@ -63,6 +114,14 @@ void WbasicDatDom<aDominoType>::replaceShared(const Domino::EvName& aEvName, std
         WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName << " is not write-protect so unavailable via this func!!!")
     else aDominoType::replaceShared(aEvName, aSharedData);
 }
+template<typename aDominoType>
+void WbasicDatDom<aDominoType>::replaceShared(const EventHandle aHdl, std::shared_ptr<void> aSharedData)
+{
+    if (isWrCtrl(aHdl))
+        WRN("(WbasicDatDom) Failed!!! event=" << aHdl.event()
+            << " is not write-protect so unavailable via this func!!!")
+    else aDominoType::replaceShared(aHdl, aSharedData);
+}
 
 // ***********************************************************************************************
 template<typename aDominoType>
@@ -73,6 +132,14 @@ std::shared_ptr<void> WbasicDatDom<aDominoType>::wbasic_getShared(const Domino::
     WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName << " is not write-protect so unavailable via this func!!!");
     return std::shared_ptr<void>();
 }
+template<typename aDominoType>
+std::shared_ptr<void> WbasicDatDom<aDominoType>::wbasic_getShared(const EventHandle aHdl)
+{
+    if (isWrCtrl(aHdl)) return aDominoType::getShared(aHdl);
+
+    WRN("(WbasicDatDom) Failed!!! event=" << aHdl.event() << " is not write-protect so unavailable via this func!!!");
+    return std::shared_ptr<void>();
+}
 
 // ***********************************************************************************************
 template<typename aDominoType>
@@ -81,23 +148,41 @@ void WbasicDatDom<aDominoType>::wbasic_replaceShared(const Domino::EvName& aEvNa
     if (isWrCtrl(aEvName)) aDominoType::replaceShared(aEvName, aSharedData);
     else WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName << " is not write-protect so unavailable via this func!!!")
 }
+template<typename aDominoType>
+void WbasicDatDom<aDominoType>::wbasic_replaceShared(const EventHandle aHdl, std::shared_ptr<void> aSharedData)
+{
+    if (isWrCtrl(aHdl)) aDominoType::replaceShared(aHdl, aSharedData);
+    else WRN("(WbasicDatDom) Failed!!! event=" << aHdl.event()
+        << " is not write-protect so unavailable via this func!!!")
+}
 
 // ***********************************************************************************************
 template<typename aDominoType>
 bool WbasicDatDom<aDominoType>::wrCtrlOk(const Domino::EvName& aEvName)
 {
-    const auto nShared = this->nShared(aEvName);
-    if (nShared != 0)
+    return pureWrCtrlOk(this->newEvent(aEvName), this->nShared(aEvName));
+}
+template<typename aDominoType>
+bool WbasicDatDom<aDominoType>::wrCtrlOk(const EventHandle aHdl)
+{
+    return pureWrCtrlOk(this->getEventBy(aHdl), this->nShared(aHdl));
+}
+
+// ***********************************************************************************************
+template<typename aDominoType>
+bool WbasicDatDom<aDominoType>::pureWrCtrlOk(const Event aEv, const size_t aNShared)
+{
+    if (aEv == D_EVENT_FAILED_RET) return false;
+    if (aNShared != 0)
     {
-        WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName
-            << ", its nShared=" << nShared << " (must=0 otherwise may out-ctrl!!!)");
+        WRN("(WbasicDatDom) Failed!!! EvName=" << this->evName(aEv)
+            << ", its nShared=" << aNShared << " (must=0 otherwise may out-ctrl!!!)");
         return false;
     }
 
-    const auto ev = this->newEvent(aEvName);
-    if (ev >= wrCtrl_.size()) wrCtrl_.resize(ev + 1);
-    wrCtrl_[ev] = true;
-    HID("(WbasicDatDom) Succeed, EvName=" << aEvName);
+    if (aEv >= wrCtrl_.size()) wrCtrl_.resize(aEv + 1);
+    wrCtrl_[aEv] = true;
+    HID("(WbasicDatDom) Succeed, EvName=" << this->evName(aEv));
     return true;
 }
 
@@ -111,11 +196,28 @@ aDataType wbasic_getValue(aDataDominoType& aDom, const Domino::EvName& aEvName)
     auto&& data = std::static_pointer_cast<aDataType>(aDom.wbasic_getShared(aEvName));
     if (data.use_count() > 0) return *data;
 
-    auto&& log_ = aDom.log_;
+    [[maybe_unused]] auto&& log_ = aDom.log_;  // unused when CPPLOG_OFF
     WRN("(WbasicDatDom) Failed!!! EvName=" << aEvName << " not found, return undefined obj!!!");
     return aDataType();
 }
 
+template<typename aDataDominoType, typename aDataType>
+aDataType wbasic_getValue(aDataDominoType& aDom, const typename aDataDominoType::EventHandle aHdl)
+{
+    auto&& data = std::static_pointer_cast<aDataType>(aDom.wbasic_getShared(aHdl));
+    if (data.use_count() > 0) return *data;
+
+    [[maybe_unused]] auto&& log_ = aDom.log_;  // unused when CPPLOG_OFF
+    WRN("(WbasicDatDom) Failed!!! event=" << aHdl.event() << " not found, return undefined obj!!!");
+    return aDataType();
+}
+
+template<typename aDataDominoType, typename aDataType>
+aDataType wbasic_getValue(aDataDominoType& aDom, const HashedEvName& aEvName)
+{
+    return wbasic_getValue<aDataDominoType, aDataType>(aDom, aDom.newHandle(aEvName));
+}
+
 // ***********************************************************************************************
 template<typename aDataDominoType, typename aDataType>
 void wbasic_setValue(aDataDominoType& aDom, const Domino::EvName& aEvName, const aDataType& aData)
@@ -123,6 +225,16 @@ void wbasic_setValue(aDataDominoType& aDom, const Domino::EvName& aEvName, const
     auto&& data = std::make_shared<aDataType>(aData);
     aDom.wbasic_replaceShared(aEvName, data);
 }
+template<typename aDataDominoType, typename aDataType>
+void wbasic_setValue(aDataDominoType& aDom, const typename aDataDominoType::EventHandle aHdl, const aDataType& aData)
+{
+    aDom.wbasic_replaceShared(aHdl, std::make_shared<aDataType>(aData));
+}
+template<typename aDataDominoType, typename aDataType>
+void wbasic_setValue(aDataDominoType& aDom, const HashedEvName& aEvName, const aDataType& aData)
+{
+    aDom.wbasic_replaceShared(aDom.newHandle(aEvName), std::make_shared<aDataType>(aData));
+}
 }  // namespace
 // ***********************************************************************************************
 // - why not wbasic_setValue() auto call wrCtrlOk()?
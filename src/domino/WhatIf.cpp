@@ -0,0 +1,166 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <iterator>  // rbegin
+
+#include "WhatIf.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+// same as BasicDomino::deduceState() but on overlay
+template<class aEvent>
+void BasicWhatIf<aEvent>::deduceState()
+{
+    const auto epoch = ++epoch_;
+    while (not candEvs_.empty())
+    {
+        const auto ev = candEvs_.back();
+        candEvs_.pop_back();
+        if (not base_.enough(ev, nUnsatPrev(ev))) continue;
+        auto&& firedEpoch = firedEpoch_[ev];
+        if (firedEpoch == epoch) continue;
+
+        firedEpoch = epoch;
+        pureSetState(ev, true);
+        pushNext(ev, true);
+    }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicWhatIf<aEvent>::SimuEvents BasicWhatIf<aEvent>::delta() const
+{
+    SimuEvents delta;
+    for (auto&& itState : states_)
+    {
+        if (itState.second != base_.state(itState.first))
+            delta.emplace(base_.evName(itState.first), itState.second);
+    }
+    return delta;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicWhatIf<aEvent>::EvNameViews BasicWhatIf<aEvent>::fired() const
+{
+    EvNameViews fired;
+    fired.reserve(fired_.size());
+    for (auto&& ev : fired_) fired.push_back(base_.evName(ev));
+    return fired;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+typename BasicWhatIf<aEvent>::EvNameViews BasicWhatIf<aEvent>::hdlrs() const
+{
+    EvNameViews hdlrs;
+    for (auto&& ev : fired_)
+        if (base_.hasEffect(ev)) hdlrs.push_back(base_.evName(ev));
+    return hdlrs;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+aEvent BasicWhatIf<aEvent>::nUnsatPrev(const Event aEv) const
+{
+    const auto it = nUnsatPrev_.find(aEv);
+    return it == nUnsatPrev_.end() ? base_.nUnsatPrev_[aEv] : it->second;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicWhatIf<aEvent>::pushNext(const Event aEv, const bool aState)
+{
+    auto&& next = base_.topo_->next_;
+    for (auto idx = next.degree(aEv); idx > 0; --idx)
+    {
+        auto&& nextEdge = next.at(aEv, idx - 1);
+        if (BasicEdgeCsr<aEvent>::flagOf(nextEdge) == aState)
+            candEvs_.push_back(BasicEdgeCsr<aEvent>::nodeOf(nextEdge));
+    }
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicWhatIf<aEvent>::pureSetState(const Event aEv, const bool aNewState)
+{
+    if (state(aEv) == aNewState) return;
+
+    states_[aEv] = aNewState;
+    auto&& next = base_.topo_->next_;
+    for (size_t idx = 0, nNext = next.degree(aEv); idx < nNext; ++idx)
+    {
+        auto&& nextEdge = next.at(aEv, idx);
+        const auto nextEv = BasicEdgeCsr<aEvent>::nodeOf(nextEdge);
+        auto&& nUnsat = nUnsatPrev_.emplace(nextEv, base_.nUnsatPrev_[nextEv]).first->second;
+        if (BasicEdgeCsr<aEvent>::flagOf(nextEdge) == aNewState) --nUnsat;
+        else ++nUnsat;
+    }
+    if (aNewState == true) fired_.push_back(aEv);  // = where Domino calls effect()
+}
+
+// ***********************************************************************************************
+// same steps as BasicDomino::pureSetStates(), so same fired order
+template<class aEvent>
+template<class aSimuEvs>
+bool BasicWhatIf<aEvent>::pureSetStates(const aSimuEvs& aSimuEvents)
+{
+    bool allKnown = true;
+    for (auto&& itSim : aSimuEvents)
+    {
+        const auto ev = base_.getEventBy(itSim.first);
+        if (ev == BasicDomino<aEvent>::D_EVENT_FAILED_RET) allKnown = false;
+        else pureSetState(ev, itSim.second);
+    }
+    for (auto&& itSim = std::rbegin(aSimuEvents); itSim != std::rend(aSimuEvents); ++itSim)  // reverse for LIFO
+    {
+        const auto ev = base_.getEventBy(itSim->first);
+        if (ev != BasicDomino<aEvent>::D_EVENT_FAILED_RET) pushNext(ev, itSim->second);
+    }
+    deduceState();
+    return allKnown;
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+void BasicWhatIf<aEvent>::reset()
+{
+    states_.clear();
+    nUnsatPrev_.clear();
+    firedEpoch_.clear();
+    fired_.clear();
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicWhatIf<aEvent>::setState(const SimuEvNames aSimuEvents)
+{
+    return pureSetStates(aSimuEvents);
+}
+template<class aEvent>
+bool BasicWhatIf<aEvent>::setState(const SimuEvents& aSimuEvents)
+{
+    return pureSetStates(aSimuEvents);
+}
+
+// ***********************************************************************************************
+template<class aEvent>
+bool BasicWhatIf<aEvent>::state(const EvNameView aEvName) const
+{
+    return state(base_.getEventBy(aEvName));
+}
+template<class aEvent>
+bool BasicWhatIf<aEvent>::state(const Event aEv) const
+{
+    const auto it = states_.find(aEv);
+    return it == states_.end() ? base_.state(aEv) : it->second;
+}
+
+template class BasicWhatIf<uint16_t>;
+template class BasicWhatIf<uint32_t>;
+template class BasicWhatIf<size_t>;
+}  // namespace
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: "if these events became true/false, which tiles would fire & which hdlrs would run?"
+//   . evaluate setState() on an overlay of a base Domino, base never changed, no msg into MsgSelf
+//   . same deduction as Domino (same LIFO order, same fired events)
+// - why: check an operator action before commit it
+// - how: sparse copy-on-write overlay, only touched events' state & counter are stored, others
+//   read through to base; so cheap to create/reset, mem ~ cascade size (not nEvent)
+// - thread: many overlays can evaluate in parallel threads against the same base, as long as the
+//   base is not changed meanwhile (eg frozen & no setState()); no log (CppLog is not thread-safe)
+// - not support: new event (unknown EvName is skipped & setState() rets false), hdlr's own
+//   setState() (hdlr is not run), base's setRetract() (overlay deduces F->T only)
+// - core: states_, nUnsatPrev_
+// ***********************************************************************************************
+#pragma once
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Domino.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+template<class aEvent>
+class BasicWhatIf
+{
+public:
+    using Event       = aEvent;
+    using EvNameView  = std::string_view;
+    using EvNameViews = std::vector<EvNameView>;
+    using SimuEvents  = typename BasicDomino<aEvent>::SimuEvents;
+    using SimuEvNames = typename BasicDomino<aEvent>::SimuEvNames;
+
+    // aBase must outlive this & not change while this is used
+    explicit BasicWhatIf(const BasicDomino<aEvent>& aBase) : base_(aBase) {}
+
+    bool setState(const SimuEvNames);  // accumulate onto overlay; false if any unknown EvName
+    bool setState(const SimuEvents&);
+    bool state(const EvNameView aEvName) const;  // overlay's view
+    void reset();                                // = back to base
+
+    // -------------------------------------------------------------------------------------------
+    // result since construct/reset():
+    SimuEvents  delta() const;  // [evName]=new state, only which differs from base
+    EvNameViews fired() const;  // F->T (set or deduced) in effect() order, ie tiles would fire
+    EvNameViews hdlrs() const;  // subset of fired() whose effect() would do sth (eg trigger hdlr)
+    size_t nTouched() const { return states_.size(); }
+
+private:
+    bool state(const Event) const;
+    Event nUnsatPrev(const Event) const;
+    template<class aSimuEvs> bool pureSetStates(const aSimuEvs&);
+    void pureSetState(const Event, const bool aNewState);
+    void pushNext(const Event, const bool aState);
+    void deduceState();
+
+    // -------------------------------------------------------------------------------------------
+    const BasicDomino<aEvent>& base_;
+    std::unordered_map<Event, bool>  states_;      // [event]=overlay state, only touched
+    std::unordered_map<Event, Event> nUnsatPrev_;  // [event]=overlay counter, only changed
+    std::vector<Event> candEvs_;                   // deduceState()'s worklist
+    std::unordered_map<Event, size_t> firedEpoch_; // fire once per deduceState(), like Domino
+    size_t epoch_ = 0;
+    std::vector<Event> fired_;
+};
+
+using WhatIf = BasicWhatIf<size_t>;
+
+extern template class BasicWhatIf<uint16_t>;
+extern template class BasicWhatIf<uint32_t>;
+extern template class BasicWhatIf<size_t>;
+}  // namespace
@@ -0,0 +1,73 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>  // min
+
+#include "WorkerPool.hpp"
+
+namespace RLib
+{
+// ***********************************************************************************************
+WorkerPool::WorkerPool(const size_t aNWorker)
+{
+    workers_.reserve(aNWorker);
+    for (size_t thrd = 1; thrd <= aNWorker; ++thrd) workers_.emplace_back([this, thrd] { loop(thrd); });
+}
+
+// ***********************************************************************************************
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto&& worker : workers_) worker.join();
+}
+
+// ***********************************************************************************************
+void WorkerPool::loop(const size_t aThrd)
+{
+    size_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        cv_.wait(lock, [this, seen] { return stop_ || round_ != seen; });
+        if (stop_) return;
+
+        seen = round_;
+        if (aThrd >= nThrd_) continue;  // not in this round
+        const auto job = job_;
+        lock.unlock();
+        (*job)(aThrd);
+        lock.lock();
+        if (--nBusy_ == 0) doneCv_.notify_one();
+    }
+}
+
+// ***********************************************************************************************
+void WorkerPool::run(const Job& aJob, const size_t aNThrd)
+{
+    const auto nThrd = std::min(aNThrd, nWorker() + 1);
+    if (nThrd > 1)
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            job_ = &aJob;
+            nThrd_ = nThrd;
+            nBusy_ = nThrd - 1;
+            ++round_;
+        }
+        cv_.notify_all();
+    }
+    aJob(0);
+    if (nThrd <= 1) return;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCv_.wait(lock, [this] { return nBusy_ == 0; });
+    job_ = nullptr;
+}
+}  // namespace
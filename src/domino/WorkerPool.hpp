@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: fixed threads to run 1 job per thread index, eg Domino::setParallel()'s components
+//   . run(aJob, aNThrd): aJob(0) on caller, aJob(1..aNThrd-1) on workers, return after all done
+// - why: create+join std::thread per setState() costs ~10us/thread, more than a small batch's deduce
+// - how: workers sleep on cv_ till next round_, caller sleeps on doneCv_ till nBusy_ = 0
+// - not copyable: threads belong to the owner instance
+// - core: round_, job_
+// ***********************************************************************************************
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RLib
+{
+// ***********************************************************************************************
+class WorkerPool
+{
+public:
+    using Job = std::function<void(const size_t aThrd)>;
+
+    explicit WorkerPool(const size_t aNWorker);
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    ~WorkerPool();  // join all
+
+    void run(const Job& aJob, const size_t aNThrd);  // aNThrd <= nWorker() + 1; not reentrant
+    size_t nWorker() const { return workers_.size(); }
+
+private:
+    void loop(const size_t aThrd);
+
+    // -------------------------------------------------------------------------------------------
+    std::mutex mutex_;
+    std::condition_variable cv_;      // to workers: new round or stop
+    std::condition_variable doneCv_;  // to caller: nBusy_ = 0
+    size_t round_ = 0;                // inc per run()
+    const Job* job_ = nullptr;        // valid during run()
+    size_t nThrd_ = 0;                // of current round
+    size_t nBusy_ = 0;                // workers not done current round
+    bool stop_ = false;
+
+    std::vector<std::thread> workers_;  // last, so started after all above initialized
+};
+}  // namespace
@@ -19,7 +19,7 @@
 
 namespace RLib
 {
-#if 1
+#ifndef CPPLOG_OFF  // eg benchmark build with -DCPPLOG_OFF
 // log_ instead of this->log_ so support static log_
 #define BUF(content) log_.prefix_ << "] " << __func__ << "()" << __LINE__ << "#; " << content << std::endl
 #define DBG(content) { CppLog::smartLog_ << "[DBG/" << BUF(content); }
@@ -27,7 +27,7 @@ namespace RLib
 #define WRN(content) { CppLog::smartLog_ << "[WRN/" << BUF(content); }
 #define ERR(content) { CppLog::smartLog_ << "[ERR/" << BUF(content); }
 #define HID(content) { CppLog::smartLog_ << "[HID/" << BUF(content); }
-#else  // eg code coverage
+#else  // eg code coverage, benchmark
 #define DBG(content) {}
 #define INF(content) {}
 #define WRN(content) {}
@@ -5,6 +5,7 @@
  */
 // ***********************************************************************************************
 #include "MsgSelf.hpp"
+#include "TraceRing.hpp"
 
 namespace RLib
 {
@@ -29,8 +30,10 @@ bool MsgSelf::handleOneMsg()
         auto&& oneQueue = msgQueues_[priority];
         if (oneQueue.empty()) continue;
 
-        auto&& hdlr = oneQueue.front().lock();
+        auto&& hdlr = oneQueue.front().cb_.lock();
+        TraceRing::record(TraceRing::MSG_BEGIN, priority, TraceRing::NO_SRC);
         if (hdlr && *hdlr) (*hdlr)();
+        TraceRing::record(TraceRing::MSG_END, priority, TraceRing::NO_SRC);
         oneQueue.pop();
         --nMsg_;
         HID("after call, nHdlrRef=" << hdlr.use_count());
@@ -58,7 +61,19 @@ void MsgSelf::loopBack(const std::shared_ptr<bool> aValidMsgSelf)
 // ***********************************************************************************************
 void MsgSelf::newMsg(const WeakMsgCB& aMsgCB, const EMsgPriority aPriority)
 {
-    msgQueues_[aPriority].push(aMsgCB);
+    pushMsg(Msg{aMsgCB, nullptr}, aPriority);
+}
+
+// ***********************************************************************************************
+void MsgSelf::ownMsg(const SharedMsgCB& aMsgCB, const EMsgPriority aPriority)
+{
+    pushMsg(Msg{aMsgCB, aMsgCB}, aPriority);
+}
+
+// ***********************************************************************************************
+void MsgSelf::pushMsg(Msg&& aMsg, const EMsgPriority aPriority)
+{
+    msgQueues_[aPriority].push(std::move(aMsg));
     ++nMsg_;
     if (nMsg_ > 1) return;
 
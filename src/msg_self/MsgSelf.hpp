@@ -12,6 +12,7 @@
 //   . encapsulate diff solution (async, IM, syscom, etc)
 // - how:
 //   . newMsg(): send msgHdlr into msgQueues_ (all info are in msgHdlr so func<void()> is enough)
+//   . ownMsg(): same but MsgSelf owns msgHdlr till called/discarded (eg one-off wrapper of a hdlr)
 //   . loopBack(): call all msgHdlr in msgQueues_, priority then FIFO
 // - core: msgQueues_
 // - which way?    speed                   UT                           code
@@ -65,6 +66,7 @@ public:
     ~MsgSelf();
 
     void newMsg(const WeakMsgCB& aMsgCB, const EMsgPriority = EMsgPri_NORM);
+    void ownMsg(const SharedMsgCB& aMsgCB, const EMsgPriority = EMsgPri_NORM);  // freed even if never called
     const std::shared_ptr<bool> getValid() const { return isValid_; }
 
     bool hasMsg() const { return nMsg_; }
@@ -72,11 +74,17 @@ public:
     size_t nMsg(const EMsgPriority aPriority) const { return msgQueues_[aPriority].size(); }
 
 private:
+    struct Msg
+    {
+        WeakMsgCB   cb_;
+        SharedMsgCB owned_;  // by ownMsg() only
+    };
+    void pushMsg(Msg&&, const EMsgPriority);
     bool handleOneMsg();
     void loopBack(const std::shared_ptr<bool> aValidMsgSelf = std::make_shared<bool>(true));
 
     // -------------------------------------------------------------------------------------------
-    std::queue<WeakMsgCB> msgQueues_[EMsgPri_MAX];
+    std::queue<Msg> msgQueues_[EMsgPri_MAX];
 
     std::shared_ptr<bool> isValid_ = std::make_shared<bool>(true);  // MsgSelf is still valid?
     LoopReqFUNC loopReq_;
@@ -0,0 +1,196 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <algorithm>  // stable_sort
+#include <chrono>
+#include <cstdint>    // SIZE_MAX
+#include <memory>     // unique_ptr
+#include <mutex>
+#include <thread>     // sleep_for
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>  // __rdtsc
+#endif
+
+#include "TraceRing.hpp"
+
+namespace RLib
+{
+std::atomic<bool> TraceRing::on_{false};
+
+namespace
+{
+// ***********************************************************************************************
+struct Ring  // 1 writer (its thread); readers only when writer quiet
+{
+    std::vector<TraceRing::Record> slots_;  // size 2^n
+    std::atomic<uint64_t> head_{0};         // num of records ever pushed
+    uint16_t thread_ = 0;
+    bool exited_ = false;  // its thread exited, records kept till collect()/start()
+    bool free_ = false;    // exited & records collected/dropped, so reusable by new thread
+};
+struct Rings  // all threads' rings; kept after thread exit till collected, then reused
+{
+    std::mutex mutex_;  // only for new ring, thread exit, start() & collect(), not per record
+    std::vector<std::unique_ptr<Ring> > rings_;
+    size_t capacity_ = 1u << 16;
+    size_t maxThread_ = TraceRing::MAX_THREAD;
+    std::atomic<size_t> nStart_{0};     // inc by start(), so refused thread retries once per start()
+    std::atomic<size_t> nNoRing_{0};    // records dropped since no ring (maxThread_ reached)
+};
+Rings& rings()
+{
+    static Rings rings;
+    return rings;
+}
+
+Ring* newRing()  // for this thread; nullptr if maxThread_ reached
+{
+    auto&& all = rings();
+    std::lock_guard<std::mutex> lock(all.mutex_);
+    for (auto&& ring : all.rings_)
+    {
+        if (not ring->free_) continue;
+        ring->exited_ = ring->free_ = false;
+        ring->slots_.resize(all.capacity_);
+        ring->head_.store(0, std::memory_order_relaxed);
+        return ring.get();
+    }
+    if (all.rings_.size() >= all.maxThread_) return nullptr;  // thread_ is uint16_t, never wrap
+
+    all.rings_.push_back(std::make_unique<Ring>());
+    auto&& ring = all.rings_.back();
+    ring->slots_.resize(all.capacity_);
+    ring->thread_ = uint16_t(all.rings_.size() - 1);
+    return ring.get();
+}
+
+struct MyRing  // this thread's
+{
+    Ring* ring_ = nullptr;
+    size_t refusedAt_ = SIZE_MAX;  // nStart_ when newRing() refused
+
+    Ring* get()
+    {
+        if (ring_ == nullptr && refusedAt_ != rings().nStart_.load(std::memory_order_relaxed))
+        {
+            ring_ = newRing();
+            if (ring_ == nullptr) refusedAt_ = rings().nStart_.load(std::memory_order_relaxed);
+        }
+        return ring_;
+    }
+    ~MyRing()  // thread exit
+    {
+        if (ring_ == nullptr) return;
+        std::lock_guard<std::mutex> lock(rings().mutex_);
+        ring_->exited_ = true;
+        ring_->free_ = ring_->head_.load(std::memory_order_relaxed) == 0;  // nothing to collect
+    }
+};
+thread_local MyRing myRing;
+
+size_t pow2(const size_t aN)
+{
+    size_t n = 1;
+    while (n < aN) n <<= 1;
+    return n;
+}
+}  // namespace
+
+// ***********************************************************************************************
+TraceRing::Records TraceRing::collect()
+{
+    Records records;
+    auto&& all = rings();
+    std::lock_guard<std::mutex> lock(all.mutex_);
+    for (auto&& ring : all.rings_)
+    {
+        const auto head = ring->head_.load(std::memory_order_acquire);
+        const auto size = ring->slots_.size();
+        for (auto idx = head > size ? head - size : 0; idx < head; ++idx)
+            records.push_back(ring->slots_[idx & (size - 1)]);
+        if (ring->exited_) ring->free_ = true;  // its records now owned by caller
+    }
+    std::stable_sort(records.begin(), records.end(),
+        [](const Record& aLeft, const Record& aRight) { return aLeft.tsc_ < aRight.tsc_; });
+    return records;
+}
+
+// ***********************************************************************************************
+size_t TraceRing::nDropped()
+{
+    auto&& all = rings();
+    size_t nDropped = all.nNoRing_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(all.mutex_);
+    for (auto&& ring : all.rings_)
+    {
+        const auto head = ring->head_.load(std::memory_order_acquire);
+        if (head > ring->slots_.size()) nDropped += head - ring->slots_.size();
+    }
+    return nDropped;
+}
+
+// ***********************************************************************************************
+uint64_t TraceRing::now()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// ***********************************************************************************************
+double TraceRing::ticksPerUs()
+{
+    static const double rate = []
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        const auto tscBegin = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const auto tscEnd = now();
+        const auto us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+        return (tscEnd - tscBegin) / us;
+    }();
+    return rate;
+}
+
+// ***********************************************************************************************
+void TraceRing::push(const Kind aKind, const uint64_t aId, const uint32_t aSrc)
+{
+    const auto ring = myRing.get();  // 1st record of this thread: new or reused ring
+    if (ring == nullptr)
+    {
+        rings().nNoRing_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const auto head = ring->head_.load(std::memory_order_relaxed);
+    ring->slots_[head & (ring->slots_.size() - 1)] = Record{now(), aId, aSrc, aKind, ring->thread_};
+    ring->head_.store(head + 1, std::memory_order_release);
+}
+
+// ***********************************************************************************************
+void TraceRing::start(const size_t aCapacity, const size_t aMaxThread)
+{
+    stop();
+    auto&& all = rings();
+    {
+        std::lock_guard<std::mutex> lock(all.mutex_);
+        all.capacity_ = pow2(aCapacity);
+        all.maxThread_ = std::min<size_t>(aMaxThread, MAX_THREAD);  // existing rings kept even if more
+        for (auto&& ring : all.rings_)
+        {
+            ring->slots_.resize(all.capacity_);
+            ring->head_.store(0, std::memory_order_relaxed);
+            if (ring->exited_) ring->free_ = true;  // records dropped
+        }
+        all.nNoRing_.store(0, std::memory_order_relaxed);
+        all.nStart_.fetch_add(1, std::memory_order_relaxed);
+    }
+    myRing.get();  // preallocate caller's
+    on_.store(true, std::memory_order_relaxed);
+}
+}  // namespace
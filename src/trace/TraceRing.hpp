@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+// - what: low-overhead recorder of Domino/MsgSelf transitions, eg to reproduce a prod perf issue
+//   . record(): 1 fixed-size Record (TSC + id + kind) into calling thread's own ring, no lock, no
+//     alloc (ring preallocated on thread's 1st record); oldest overwritten when full
+//   . off (default): record() = 1 relaxed atomic load
+//   . collect(): all threads' rings merged by TSC, eg then DominoReplay::save()
+//   . exited thread's ring kept till collect()/start(), then reused by a new thread; at most
+//     aMaxThread rings (Record::thread_ never wraps), more threads' records dropped (nDropped())
+// - why: log is too slow & too big to keep on in prod; trace keeps last N transitions cheaply
+// - limit: start()/collect() when recording threads are quiet (eg after stop()); TSC is raw cycles
+//   (steady_clock ns if no TSC), comparable within 1 host only
+// - core: on_, Ring
+// ***********************************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace RLib
+{
+// ***********************************************************************************************
+class TraceRing
+{
+public:
+    enum Kind : uint16_t
+    {
+        SET_BEGIN,     // setState() (user/hdlr/mounted child), id=nInput
+        SET_FALSE,     // 1 input of setState(), id=event
+        SET_TRUE,
+        SET_END,       // all inputs set (deduce follows); nested SET_BEGIN~END if hdlr setState() meanwhile
+        STATE_FALSE,   // any state change (set or deduced), id=event
+        STATE_TRUE,
+        EFFECT,        // effect() of event, eg trigger hdlr
+        TRIGGER_HDLR,  // hdlr into MsgSelf, id=event
+        MSG_BEGIN,     // MsgSelf dispatches 1 msg, id=priority
+        MSG_END,
+        HDLR_BEGIN,    // HdlrDomino's hdlr runs, id=event (queued at TRIGGER_HDLR)
+        HDLR_END,
+    };
+    enum : uint32_t { NO_SRC = UINT32_MAX };  // eg MsgSelf's records
+    enum : size_t { MAX_THREAD = size_t(UINT16_MAX) + 1 };  // rings, see Record::thread_
+
+    struct Record
+    {
+        uint64_t tsc_;
+        uint64_t id_;      // see Kind
+        uint32_t src_;     // eg Domino's id
+        uint16_t kind_;
+        uint16_t thread_;  // which ring (thread) recorded it
+    };
+    using Records = std::vector<Record>;
+
+    // aCapacity per thread, rounded up to 2^n; drop old records
+    static void start(const size_t aCapacity = 1u << 16, const size_t aMaxThread = MAX_THREAD);
+    static void stop() { on_.store(false, std::memory_order_relaxed); }
+    static bool on() { return on_.load(std::memory_order_relaxed); }
+    static void record(const Kind aKind, const uint64_t aId, const uint32_t aSrc)
+    {
+        if (on()) push(aKind, aId, aSrc);
+    }
+    static Records collect();  // all kept records by TSC (same TSC: per thread order)
+    static size_t nDropped();  // overwritten or w/o ring (> aMaxThread) since start()
+    static uint64_t now();     // TSC
+    static double ticksPerUs();  // TSC rate, measured once (~10ms)
+
+private:
+    static void push(const Kind, const uint64_t aId, const uint32_t aSrc);
+
+    // -------------------------------------------------------------------------------------------
+    static std::atomic<bool> on_;
+};
+}  // namespace
@@ -0,0 +1,109 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "CritPath.hpp"
+#include "DominoReplay.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct CritPathTest : public Test
+{
+    CritPathTest()
+    {
+        dom_.setMsgSelf(msgSelf_);
+        // start -> taskA -hdlr-> A done --+
+        //       -> taskB -hdlr-> B done --+-> all done
+        dom_.setPrev("taskA", {{"start", true}});
+        dom_.setPrev("taskB", {{"start", true}});
+        dom_.setPrev("all done", {{"A done", true}, {"B done", true}});
+        dom_.setHdlr("taskA", [this] { dom_.setState({{"A done", true}}); });
+        dom_.setHdlr("taskB", [this]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));  // longest task
+            dom_.setState({{"B done", true}});
+        });
+    }
+    ~CritPathTest() { TraceRing::stop(); }
+
+    void run()
+    {
+        TraceRing::start();
+        dom_.setState({{"start", true}});  // taskA then taskB queued
+        loopbackFunc_();
+        TraceRing::stop();
+    }
+    static CritPath::EvNameViews toViews(const std::vector<const char*>& aNames)
+    {
+        return CritPath::EvNameViews(aNames.begin(), aNames.end());
+    }
+
+    UtInitObjAnywhere utInit_;
+    LoopBackFUNC loopbackFunc_;
+    std::shared_ptr<MsgSelf> msgSelf_ = std::make_shared<MsgSelf>(
+        [this](LoopBackFUNC aFunc) { loopbackFunc_ = aFunc; });
+    MinHdlrDom dom_;
+};
+
+// ***********************************************************************************************
+TEST_F(CritPathTest, GOLD_path_slack_queueDelay)
+{
+    run();
+    ASSERT_TRUE(dom_.state("all done"));
+
+    CritPath critPath(dom_, TraceRing::collect(), DominoReplay::srcOf(dom_));
+    ASSERT_TRUE(critPath.analyze());  // req: default target = last true
+    EXPECT_EQ(toViews({"start", "taskB", "B done", "all done"}), critPath.path());  // req: via prev_ & hdlr
+
+    const auto twoMs = uint64_t(TraceRing::ticksPerUs() * 1500);  // sleep >= 2ms, some margin
+    auto&& taskB = critPath.timing("taskB");
+    EXPECT_GT(taskB.hdlrTime(), twoMs);     // req: hdlr started & finished
+    EXPECT_GT(taskB.queueDelay(), 0u);      // req: queued behind taskA's hdlr
+    EXPECT_EQ(0u, taskB.slack_);            // req: on path
+    EXPECT_EQ(0u, critPath.timing("all done").slack_);
+    EXPECT_GT(critPath.timing("A done").slack_, twoMs);  // req: could be ~2ms later w/o delaying
+    EXPECT_GT(critPath.timing("taskA").slack_, twoMs);
+    EXPECT_LE(critPath.timing("start").true_, critPath.timing("taskA").true_);  // req: when became true
+
+    const auto report = critPath.report();
+    EXPECT_NE(std::string::npos, report.find("critical path: 4 tiles")) << report;
+    EXPECT_NE(std::string::npos, report.find("(set by hdlr of prev step)")) << report;
+}
+TEST_F(CritPathTest, target_byEvName)
+{
+    run();
+    CritPath critPath(dom_, TraceRing::collect(), DominoReplay::srcOf(dom_));
+    ASSERT_TRUE(critPath.analyze("A done"));
+    EXPECT_EQ(toViews({"start", "taskA", "A done"}), critPath.path());
+    EXPECT_EQ(CritPath::NO_SLACK, critPath.timing("taskB").slack_);  // req: not ancestor of target
+
+    EXPECT_FALSE(critPath.analyze("unknown"));
+    EXPECT_FALSE(critPath.analyze("never true"));
+    EXPECT_TRUE(critPath.path().empty());
+    EXPECT_EQ(0u, critPath.timing("unknown").true_);
+}
+TEST_F(CritPathTest, kOfN_gate_isKth)
+{
+    dom_.setPrev("any", {{"x", true}, {"y", true}});
+    dom_.setNeed("any", 1);
+    TraceRing::start();
+    dom_.setState({{"x", true}});
+    dom_.setState({{"y", true}});
+    TraceRing::stop();
+
+    CritPath critPath(dom_, TraceRing::collect(), DominoReplay::srcOf(dom_));
+    ASSERT_TRUE(critPath.analyze("any"));
+    EXPECT_EQ(toViews({"x", "any"}), critPath.path());  // req: 1st satisfied prev gated
+    EXPECT_EQ(CritPath::NO_SLACK, critPath.timing("y").slack_);
+}
+}  // namespace
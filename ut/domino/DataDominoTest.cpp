@@ -55,6 +55,23 @@ TYPED_TEST_P(DataDominoTest, GOLD_setValue_thenGetIt)
     valGet = getValue<TypeParam, size_t>(*PARA_DOM, XPATH_BW);
     EXPECT_EQ(newValue, valGet);                 // req: newGet = newSet
 }
+TYPED_TEST_P(DataDominoTest, setValue_byHandle)
+{
+    auto&& hdl = PARA_DOM->newHandle(XPATH_BW);
+    setValue<TypeParam, size_t>(*PARA_DOM, hdl, 50000);
+    EXPECT_EQ(50000u, (getValue<TypeParam, size_t>(*PARA_DOM, hdl)));
+    EXPECT_EQ(50000u, (getValue<TypeParam, size_t>(*PARA_DOM, XPATH_BW)));  // req: same as EvName
+
+    PARA_DOM->replaceShared(Domino::EventHandle(), std::make_shared<size_t>(1));
+    EXPECT_EQ(0u, PARA_DOM->nShared(Domino::EventHandle()));                  // req: invalid handle
+}
+TYPED_TEST_P(DataDominoTest, setValue_byLiteral)
+{
+    setValue<TypeParam, size_t>(*PARA_DOM, "ev0"_ev, 1);
+    EXPECT_EQ(1u, (getValue<TypeParam, size_t>(*PARA_DOM, "ev0"_ev)));
+    EXPECT_EQ(1u, (getValue<TypeParam, size_t>(*PARA_DOM, "ev0")));  // req: same as EvName
+    EXPECT_NE(0u, PARA_DOM->nShared("ev0"_ev));
+}
 TYPED_TEST_P(DataDominoTest, get_noData)
 {
     getValue<TypeParam, int>(*PARA_DOM, "not exist event");
@@ -94,6 +111,21 @@ TYPED_TEST_P(DataDominoTest, GOLD_correct_data_destructor)
     PARA_DOM->replaceShared("ev", std::shared_ptr<TestData>());
     EXPECT_TRUE(isDestructed);
 }
+TYPED_TEST_P(DataDominoTest, rmEvent_rmData_compactKeep)
+{
+    PARA_DOM->replaceShared("session 1", std::make_shared<char>('A'));
+    std::weak_ptr<void> weak = PARA_DOM->getShared("session 1");
+    PARA_DOM->replaceShared("e2", std::make_shared<char>('B'));
+
+    EXPECT_TRUE(PARA_DOM->rmEvent("session 1"));
+    EXPECT_EQ(0, weak.use_count());  // req: data rm w/ ev
+    PARA_DOM->newEvent("session 2");  // reuse Event
+    EXPECT_EQ(0u, PARA_DOM->nShared("session 2"));
+
+    PARA_DOM->rmEvent("session 2");
+    EXPECT_TRUE(PARA_DOM->compact());
+    EXPECT_EQ('B', (getValue<TypeParam, char>(*PARA_DOM, "e2")));  // req: data follows renumbered ev
+}
 
 #define ID_STATE
 // ***********************************************************************************************
@@ -122,9 +154,12 @@ TYPED_TEST_P(DataDominoTest, GOLD_nonConstInterface_shall_createUnExistEvent_wit
 REGISTER_TYPED_TEST_SUITE_P(DataDominoTest
     , GOLD_setShared_thenGetIt
     , GOLD_setValue_thenGetIt
+    , setValue_byHandle
+    , setValue_byLiteral
     , get_noData
     , GOLD_desruct_data
     , GOLD_correct_data_destructor
+    , rmEvent_rmData_compactKeep
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
 using AnyDatDom = Types<MinDatDom, MaxNofreeDom, MaxDom>;
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <cstdio>  // remove
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "DominoJournal.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct DominoJournalTest : public Test
+{
+    DominoJournalTest() { std::remove(path_.c_str()); }
+    ~DominoJournalTest() { std::remove(path_.c_str()); }
+
+    std::string readAll() const
+    {
+        std::ifstream file(path_, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    const std::string path_ = TempDir() + "DominoJournalTest.journal";
+    std::vector<DominoJournal::Record> records_;
+};
+
+// ***********************************************************************************************
+TEST_F(DominoJournalTest, GOLD_append_commit_reopen)
+{
+    {
+        DominoJournal journal;
+        ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+        EXPECT_TRUE(records_.empty());  // req: new file
+        journal.append(3, DominoJournal::SET_TRUE);
+        journal.append(3, DominoJournal::HDLR_DONE);
+        journal.append(5, DominoJournal::SET_TRUE);
+        EXPECT_TRUE(journal.commit());
+        journal.append(5, DominoJournal::SET_FALSE);
+    }  // req: destructor commits
+
+    DominoJournal journal;
+    ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+    EXPECT_EQ(std::vector<DominoJournal::Record>({
+        DominoJournal::toRecord(3, DominoJournal::SET_TRUE),
+        DominoJournal::toRecord(3, DominoJournal::HDLR_DONE),
+        DominoJournal::toRecord(5, DominoJournal::SET_TRUE),
+        DominoJournal::toRecord(5, DominoJournal::SET_FALSE)}), records_);  // req: w/o COMMIT
+    EXPECT_EQ(DominoJournal::DoneCount({{3, 1}}), journal.done());
+}
+TEST_F(DominoJournalTest, batch_commitPerNBatch)
+{
+    DominoJournal journal;
+    ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+    journal.setSync(false);
+    journal.setBatch(3);
+    for (uint64_t ev = 0; ev < 6; ++ev)
+    {
+        journal.append(ev, DominoJournal::SET_TRUE);
+        journal.endBatch();
+    }
+    EXPECT_EQ(2u, journal.nCommit());  // req: group commit
+}
+TEST_F(DominoJournalTest, GOLD_tornTail_cut)
+{
+    {
+        DominoJournal journal;
+        ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+        journal.append(1, DominoJournal::SET_TRUE);
+        journal.commit();
+    }
+    const auto committed = readAll();
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::app);
+        const auto rec = DominoJournal::toRecord(2, DominoJournal::SET_TRUE);
+        file.write(reinterpret_cast<const char*>(&rec), sizeof(rec));  // crash before COMMIT
+        file.write("abc", 3);                                          // crash mid-write
+    }
+
+    DominoJournal journal;
+    ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+    EXPECT_EQ(std::vector<DominoJournal::Record>{DominoJournal::toRecord(1, DominoJournal::SET_TRUE)}, records_);
+    EXPECT_EQ(committed, readAll());  // req: torn tail cut, so next append after committed
+}
+TEST_F(DominoJournalTest, reset_keepDone)
+{
+    DominoJournal journal;
+    ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+    journal.append(1, DominoJournal::SET_TRUE);
+    journal.append(1, DominoJournal::HDLR_DONE);
+    ASSERT_TRUE(journal.reset(11));
+
+    DominoJournal reopen;
+    EXPECT_FALSE(reopen.open(path_, 8, 10, records_));  // req: reset to new topology
+    ASSERT_TRUE(reopen.open(path_, 8, 11, records_));
+    EXPECT_EQ(std::vector<DominoJournal::Record>{DominoJournal::toRecord(1, DominoJournal::HDLR_DONE)}, records_);
+}
+
+#define INVALID_FILE
+// ***********************************************************************************************
+TEST_F(DominoJournalTest, headerMismatch_nok)
+{
+    {
+        DominoJournal journal;
+        ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+        EXPECT_FALSE(journal.open(path_, 8, 10, records_));  // req: already open
+    }
+    DominoJournal journal;
+    EXPECT_FALSE(journal.open(path_, 4, 10, records_));  // req: other Event width
+    EXPECT_FALSE(journal.open(path_, 8, 9, records_));   // req: other topology
+    EXPECT_TRUE(journal.open(path_, 8, 10, records_));
+
+    DominoJournal notExistDir;
+    EXPECT_FALSE(notExistDir.open(path_ + ".none/x", 8, 10, records_));
+}
+TEST_F(DominoJournalTest, topoChanged_nok_tillReset)
+{
+    {
+        DominoJournal journal;
+        ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+        journal.append(1, DominoJournal::SET_TRUE);
+        journal.topoChanged();
+        journal.topoChanged();  // 1 record enough
+        journal.append(2, DominoJournal::SET_TRUE);
+    }
+    {
+        DominoJournal journal;
+        EXPECT_FALSE(journal.open(path_, 8, 10, records_));  // req: later records may be other events
+    }
+    {
+        DominoJournal journal;
+        std::remove(path_.c_str());
+        ASSERT_TRUE(journal.open(path_, 8, 10, records_));
+        journal.topoChanged();
+        EXPECT_TRUE(journal.reset(11));  // eg checkpoint() after change
+        journal.append(2, DominoJournal::SET_TRUE);
+    }
+    DominoJournal journal;
+    ASSERT_TRUE(journal.open(path_, 8, 11, records_));
+    EXPECT_EQ(std::vector<DominoJournal::Record>{DominoJournal::toRecord(2, DominoJournal::SET_TRUE)}, records_);
+}
+}  // namespace
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <cstdio>  // remove
+#include <gtest/gtest.h>
+#include <utility>  // pair
+
+#include "DominoReplay.hpp"
+#include "DominoWorkload.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct DominoReplayTest : public Test
+{
+    ~DominoReplayTest()
+    {
+        TraceRing::stop();
+        std::remove(snapshot_.c_str());
+        std::remove(trace_.c_str());
+    }
+
+    // what 1 Domino did, in order
+    static std::vector<std::pair<uint16_t, uint64_t> > transitions(const TraceRing::Records& aRecords,
+        const uint32_t aSrc)
+    {
+        std::vector<std::pair<uint16_t, uint64_t> > transitions;
+        for (auto&& rec : aRecords)
+        {
+            if (rec.src_ == aSrc && rec.kind_ >= TraceRing::STATE_FALSE && rec.kind_ <= TraceRing::TRIGGER_HDLR)
+                transitions.emplace_back(rec.kind_, rec.id_);
+        }
+        return transitions;
+    }
+
+    UtInitObjAnywhere utInit_;
+    const std::string snapshot_ = TempDir() + "DominoReplayTest.snapshot";
+    const std::string trace_ = TempDir() + "DominoReplayTest.trace";
+};
+
+// ***********************************************************************************************
+TEST_F(DominoReplayTest, GOLD_record_save_replay_sameTransitions)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = 500;
+    cfg.falsePct = 10;
+    const auto wl = genWorkload(cfg);
+
+    MinHdlrDom recorded;
+    loadWorkload(recorded, wl);
+    ASSERT_TRUE(recorded.save(snapshot_));  // start point of replay
+    size_t nHdlr = 0;
+    setWorkloadHdlr(recorded, wl, [&nHdlr] { ++nHdlr; });
+    nHdlr = 0;  // not count hdlr of event already true by setPrev(), ie before trace
+    TraceRing::start();
+    replayWorkload(recorded, wl);
+    TraceRing::stop();
+    const auto records = TraceRing::collect();
+    EXPECT_EQ(0u, TraceRing::nDropped());
+    ASSERT_TRUE(DominoReplay::save(trace_, records));
+
+    TraceRing::Records loaded;
+    ASSERT_TRUE(DominoReplay::load(trace_, loaded));
+    ASSERT_EQ(records.size(), loaded.size());
+    MinHdlrDom fresh;  // eg on dev host
+    ASSERT_TRUE(fresh.load(snapshot_));
+    DominoReplay replay(fresh, loaded, DominoReplay::srcOf(recorded));
+    ASSERT_TRUE(replay.valid());
+    EXPECT_EQ(wl.nStep(), replay.nStep());
+    size_t nReplayedHdlr = 0;
+    for (auto&& evName : replay.hdlrEvNames())
+        fresh.setHdlr(Domino::EvName(evName), [&nReplayedHdlr] { ++nReplayedHdlr; });
+    nReplayedHdlr = 0;
+
+    TraceRing::start();
+    EXPECT_EQ(wl.nStep(), replay.run());
+    TraceRing::stop();
+    EXPECT_EQ(transitions(records, DominoReplay::srcOf(recorded)),
+        transitions(TraceRing::collect(), DominoReplay::srcOf(fresh)));  // req: same deduction & order
+    EXPECT_EQ(nHdlr, nReplayedHdlr);  // req: same MsgSelf load
+    for (size_t ev = 0; ev < wl.nEvent; ++ev)
+        EXPECT_EQ(recorded.state(DominoWorkload::evName(ev)), fresh.state(DominoWorkload::evName(ev))) << ev;
+}
+TEST_F(DominoReplayTest, hdlrSetState_ownStep)
+{
+    MinHdlrDom recorded;
+    recorded.newEvent("e1");
+    recorded.newEvent("e2");
+    ASSERT_TRUE(recorded.save(snapshot_));
+    recorded.setHdlr("e1", [&recorded] { recorded.setState({{"e2", true}}); });  // sync by UT's MsgSelf
+    TraceRing::start();
+    recorded.setState({{"e1", true}});
+    TraceRing::stop();
+
+    Domino fresh;
+    ASSERT_TRUE(fresh.load(snapshot_));
+    DominoReplay replay(fresh, TraceRing::collect(), DominoReplay::srcOf(recorded));
+    EXPECT_EQ(2u, replay.nStep());  // req: hdlr's setState() replayed w/o hdlr
+    EXPECT_EQ(2u, replay.run());
+    EXPECT_TRUE(fresh.state("e1"));
+    EXPECT_TRUE(fresh.state("e2"));
+}
+TEST_F(DominoReplayTest, otherTopology_invalid)
+{
+    Domino recorded;
+    recorded.setPrev("e2", {{"e1", true}});
+    TraceRing::start();
+    recorded.setState({{"e1", true}});
+    TraceRing::stop();
+
+    Domino fresh;
+    DominoReplay replay(fresh, TraceRing::collect(), DominoReplay::srcOf(recorded));
+    EXPECT_FALSE(replay.valid());  // req: recorded event not in fresh
+    EXPECT_EQ(0u, replay.run());
+
+    TraceRing::Records loaded;
+    EXPECT_FALSE(DominoReplay::load(trace_ + ".none", loaded));
+}
+}  // namespace
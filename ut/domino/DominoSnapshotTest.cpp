@@ -0,0 +1,119 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <cstdio>  // remove
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+#include "DominoSnapshot.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct DominoSnapshotTest : public Test
+{
+    ~DominoSnapshotTest() { std::remove(path_.c_str()); }
+
+    std::string readAll() const
+    {
+        std::ifstream file(path_, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    void writeAll(const std::string& aBytes) const
+    {
+        std::ofstream(path_, std::ios::binary | std::ios::trunc).write(aBytes.data(), aBytes.size());
+    }
+
+    const std::string path_ = TempDir() + "DominoSnapshotTest.snapshot";
+    const DominoSnapshot::Tag u32_  = DominoSnapshot::tagOf("u32_");
+    const DominoSnapshot::Tag bool_ = DominoSnapshot::tagOf("bool");
+    const DominoSnapshot::Tag str_  = DominoSnapshot::tagOf("str_");
+};
+
+// ***********************************************************************************************
+TEST_F(DominoSnapshotTest, GOLD_put_save_open_get)
+{
+    DominoSnapshot out;
+    out.put(u32_, std::vector<uint32_t>{1, 2, 3});
+    out.put(bool_, std::vector<bool>{true, false, true});
+    out.put(str_, std::string("abcde"));  // odd size, next section still aligned
+    out.put(DominoSnapshot::tagOf("void"), std::vector<uint64_t>());
+    ASSERT_TRUE(out.save(path_, sizeof(uint32_t)));
+
+    DominoSnapshot in;
+    ASSERT_TRUE(in.open(path_));
+    EXPECT_EQ(sizeof(uint32_t), in.eventBytes());
+
+    std::vector<uint32_t> u32s;
+    EXPECT_TRUE(in.get(u32_, u32s, 3));
+    EXPECT_EQ(std::vector<uint32_t>({1, 2, 3}), u32s);
+    std::vector<bool> bools;
+    EXPECT_TRUE(in.get(bool_, bools));
+    EXPECT_EQ(std::vector<bool>({true, false, true}), bools);
+
+    size_t count = 0;
+    const auto chars = in.view<char>(str_, count);
+    ASSERT_NE(nullptr, chars);
+    EXPECT_EQ("abcde", std::string(chars, count));  // req: view w/o copy
+
+    std::vector<uint64_t> empty{7};
+    EXPECT_TRUE(in.get(DominoSnapshot::tagOf("void"), empty));
+    EXPECT_TRUE(empty.empty());  // req: empty section ok
+}
+TEST_F(DominoSnapshotTest, get_mismatch_nok)
+{
+    DominoSnapshot out;
+    out.put(u32_, std::vector<uint32_t>{1, 2, 3});
+    ASSERT_TRUE(out.save(path_, 8));
+
+    DominoSnapshot in;
+    ASSERT_TRUE(in.open(path_));
+    std::vector<uint32_t> u32s;
+    EXPECT_FALSE(in.get(u32_, u32s, 4));       // req: wrong count
+    std::vector<uint64_t> u64s;
+    EXPECT_FALSE(in.get(u32_, u64s));          // req: wrong elem size
+    EXPECT_FALSE(in.get(str_, u32s));          // req: absent
+    EXPECT_FALSE(in.has(str_));
+    size_t count = 9;
+    EXPECT_EQ(nullptr, in.view<uint32_t>(str_, count));
+    EXPECT_EQ(0u, count);
+}
+
+#define INVALID_FILE
+// ***********************************************************************************************
+TEST_F(DominoSnapshotTest, corruptFile_nok)
+{
+    DominoSnapshot snap;
+    EXPECT_FALSE(snap.open(path_ + ".none"));  // req: no file
+
+    DominoSnapshot out;
+    out.put(u32_, std::vector<uint32_t>{1, 2, 3});
+    ASSERT_TRUE(out.save(path_, 8));
+    const auto good = readAll();
+
+    writeAll(good.substr(0, good.size() - 1));
+    EXPECT_FALSE(snap.open(path_));  // req: truncated
+
+    auto bad = good;
+    bad[0] = 'X';
+    writeAll(bad);
+    EXPECT_FALSE(snap.open(path_));  // req: bad magic
+
+    bad = good;
+    ++bad[8];  // version_ follows magic_
+    writeAll(bad);
+    EXPECT_FALSE(snap.open(path_));  // req: other version
+
+    writeAll(good.substr(0, 4));
+    EXPECT_FALSE(snap.open(path_));  // req: shorter than header
+
+    writeAll(good);
+    EXPECT_TRUE(snap.open(path_));   // req: reopen ok
+}
+}  // namespace
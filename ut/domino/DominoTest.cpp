@@ -1,9 +1,15 @@
 /**
  * Copyright 2016 Nokia. All rights reserved.
  */
+#include <cstdio>  // remove
+#include <fstream>
 #include <gtest/gtest.h>
+#include <iterator>  // istreambuf_iterator
 #include <memory>  // for shared_ptr
 #include <set>
+#include <sstream>  // istringstream
+#include <string>
+#include <string_view>
 
 #include "UtInitObjAnywhere.hpp"
 
@@ -11,6 +17,46 @@ using namespace testing;
 
 namespace RLib
 {
+// ***********************************************************************************************
+// nComp independent binary trees (eg per-cell pipelines), some w/ false prev
+template<class aDom>
+void setupComps(aDom& aDom_, const size_t aNComp, const size_t aNEvPerComp)
+{
+    for (size_t comp = 0; comp < aNComp; ++comp)
+    {
+        const auto prefix = "c" + std::to_string(comp) + "/e";
+        for (size_t idx = 1; idx < aNEvPerComp; ++idx)
+        {
+            aDom_.setPrev(prefix + std::to_string(idx), {{prefix + std::to_string((idx - 1) / 2), true}});
+            if (idx % 5 == 0) aDom_.setPrev(prefix + std::to_string(idx), {{prefix + "abort", false}});
+        }
+    }
+}
+// overwrite [aIdx] of a Domino::Event section in saved snapshot, eg to corrupt it
+bool patchSnapshot(const std::string& aPath, const char (&aTag)[5], const size_t aIdx, const Domino::Event aValue)
+{
+    std::fstream file(aPath, std::ios::in | std::ios::out | std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const uint32_t hdr[] = {DominoSnapshot::tagOf(aTag), sizeof(Domino::Event)};  // SectionHdr's tag_ & elemSize_
+    const auto pos = bytes.find(std::string(reinterpret_cast<const char*>(hdr), sizeof(hdr)));
+    if (pos == std::string::npos) return false;
+
+    file.clear();
+    file.seekp(pos + sizeof(hdr) + sizeof(uint64_t) + aIdx * sizeof(aValue));  // + count_
+    file.write(reinterpret_cast<const char*>(&aValue), sizeof(aValue));
+    return bool(file);
+}
+Domino::SimuEvents compRoots(const size_t aNComp)
+{
+    Domino::SimuEvents simu;
+    for (size_t comp = 0; comp < aNComp; ++comp)
+    {
+        simu["c" + std::to_string(comp) + "/e0"] = true;
+        simu["c" + std::to_string(comp) + "/eabort"] = comp % 2;
+    }
+    return simu;
+}
+
 // ***********************************************************************************************
 template<class aParaDom>
 struct DominoTest : public Test
@@ -65,6 +111,16 @@ TYPED_TEST_P(DominoTest, stateFalse_for_not_exist_EvName)
 {
     EXPECT_FALSE(PARA_DOM->state(""));
 }
+TYPED_TEST_P(DominoTest, copy_keep_EvName_index)
+{
+    PARA_DOM->setState({{"e1", true}, {"a very long EvName to avoid small string optimization", true}});
+    const auto copied = *PARA_DOM;
+    PARA_DOM->setState({{"e1", false}});
+
+    EXPECT_EQ(PARA_DOM->getEventBy("e1"), copied.getEventBy("e1"));  // req: same index
+    EXPECT_TRUE(copied.state("e1"));                                  // req: independent state
+    EXPECT_TRUE(copied.state("a very long EvName to avoid small string optimization"));
+}
 TYPED_TEST_P(DominoTest, GOLD_setState_thenGetIt)
 {
     PARA_DOM->setState({{"", true}, {"e2", false}});  // init set multi
@@ -76,6 +132,850 @@ TYPED_TEST_P(DominoTest, GOLD_setState_thenGetIt)
     EXPECT_FALSE(PARA_DOM->state("e2"));
 }
 
+TYPED_TEST_P(DominoTest, setState_byView)
+{
+    const std::string_view e1("e1");
+    PARA_DOM->setState(e1, true);                     // req: single ev
+    EXPECT_TRUE(PARA_DOM->state(e1));
+
+    PARA_DOM->setState({{e1, false}, {"e2", true}});  // req: multi ev
+    EXPECT_FALSE(PARA_DOM->state("e1"));
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+
+    PARA_DOM->setState({{e1, true}, {e1, false}});    // req: same ev, last win
+    EXPECT_FALSE(PARA_DOM->state("e1"));
+
+    const Domino::SimuEvents simuEvents{{"e1", true}, {"e2", false}};
+    PARA_DOM->setState(simuEvents);                   // req: legacy SimuEvents still ok
+    EXPECT_TRUE(PARA_DOM->state("e1"));
+    EXPECT_FALSE(PARA_DOM->state("e2"));
+}
+
+#define EVENT_HANDLE
+// ***********************************************************************************************
+// req: pre-resolved EventHandle = EvName (w/o hash per call)
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_handle_sameAs_EvName)
+{
+    auto&& hdl = PARA_DOM->newHandle("e1");
+    EXPECT_EQ(PARA_DOM->getEventBy("e1"), hdl.event());  // req: same event
+    EXPECT_EQ(hdl.event(), PARA_DOM->getEventBy(hdl));
+
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setState(hdl, true);                        // req: set & broadcast
+    EXPECT_TRUE(PARA_DOM->state(hdl));
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+
+    PARA_DOM->setState(hdl, false);
+    EXPECT_EQ("e1==false", PARA_DOM->whyFalse(PARA_DOM->newHandle("e2")));
+    PARA_DOM->setPrev(PARA_DOM->newHandle("e3"), {{"e1", false}});
+    EXPECT_TRUE(PARA_DOM->state("e3"));
+}
+TYPED_TEST_P(DominoTest, invalidHandle_nok)
+{
+    Domino other;
+    auto&& otherHdl = other.newHandle("e1");
+    PARA_DOM->newEvent("e1");
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy(otherHdl));  // req: other Domino's
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy(Domino::EventHandle()));  // req: default
+
+    PARA_DOM->setState(otherHdl, true);                                     // req: no impact
+    EXPECT_FALSE(PARA_DOM->state("e1"));
+    EXPECT_FALSE(PARA_DOM->state(otherHdl));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev(otherHdl, {{"e2", true}}));
+    EXPECT_TRUE(PARA_DOM->whyFalse(otherHdl).empty());
+}
+
+#define HASHED_EV_NAME
+// ***********************************************************************************************
+// req: literal EvName hashed at compile time
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_literal_sameAs_EvName)
+{
+    static_assert("e1"_ev.hash() == HashedEvName::hashOf("e1"), "req: compile-time hash");
+    EXPECT_EQ(HashedEvName(std::string("e1")).hash(), "e1"_ev.hash());  // req: same as runtime
+
+    auto&& e1 = PARA_DOM->newEvent("e1"_ev);
+    EXPECT_EQ(e1, PARA_DOM->newEvent("e1"));                             // req: same event
+    EXPECT_EQ(e1, PARA_DOM->getEventBy("e1"_ev));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("not exist"_ev));
+
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setState("e1"_ev, true);                                   // req: set & broadcast
+    EXPECT_TRUE(PARA_DOM->state("e1"_ev));
+    EXPECT_TRUE(PARA_DOM->state("e2"_ev));
+}
+TYPED_TEST_P(DominoTest, noHashCollision_forManyEvName)
+{
+    for (size_t idx = 0; idx < 10'000; ++idx) PARA_DOM->newEvent("/a/b[" + std::to_string(idx) + "]/c");
+    EXPECT_EQ(0u, PARA_DOM->nHashCollision());
+    EXPECT_EQ(5000u, PARA_DOM->getEventBy("/a/b[5000]/c"));
+}
+
+#define FREEZE
+// ***********************************************************************************************
+// req: freeze after setup = same behavior, but no more setPrev()/new event
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_freeze_sameBehavior)
+{
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setPrev("e3", {{"e2", true}, {"e0", false}});
+    auto&& e3 = PARA_DOM->getEventBy("e3");
+    PARA_DOM->freeze();
+    EXPECT_TRUE(PARA_DOM->frozen());
+
+    EXPECT_EQ(e3, PARA_DOM->getEventBy("e3"));                               // req: same lookup
+    EXPECT_EQ(e3, PARA_DOM->getEventBy("e3"_ev));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("not exist"));
+
+    PARA_DOM->setState({{"e1", true}});                                       // req: same broadcast
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+    EXPECT_TRUE(PARA_DOM->state("e3"));
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_EQ("e0==true", PARA_DOM->whyFalse("e4") + PARA_DOM->whyFalse("e3"));
+
+    const auto copied = *PARA_DOM;                                            // req: copy frozen
+    EXPECT_EQ(e3, copied.getEventBy("e3"));
+}
+TYPED_TEST_P(DominoTest, freeze_refuseSetup_tillThaw)
+{
+    PARA_DOM->newEvent("e1");
+    PARA_DOM->freeze();
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->newEvent("e2"));         // req: no new ev
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e1", {{"e0", true}}));  // req: no new edge
+    PARA_DOM->setState({{"e2", true}, {"e1", true}});                         // req: unknown ignored
+    EXPECT_TRUE(PARA_DOM->state("e1"));
+    EXPECT_EQ(1u, PARA_DOM->nEvent());
+
+    PARA_DOM->thaw();
+    EXPECT_FALSE(PARA_DOM->frozen());
+    EXPECT_EQ(0u, PARA_DOM->getEventBy("e1"));                                // req: keep index
+    EXPECT_EQ(1u, PARA_DOM->newEvent("e2"));                                  // req: editable again
+    EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e2", {{"e1", true}}));
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+}
+
+#define MEM_FOOTPRINT
+// ***********************************************************************************************
+// req: EvName stored once (arena)
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, evName_storedOnce)
+{
+    const size_t nEvent = 1000;
+    size_t nChar = 0;
+    for (size_t idx = 0; idx < nEvent; ++idx)
+    {
+        const auto name = "/o-ran-hw:hardware/component[name=ru-" + std::to_string(idx) + "]/state/oper-state";
+        nChar += name.size();
+        PARA_DOM->newEvent(name);
+    }
+    auto&& mem = PARA_DOM->memFootprint();
+    EXPECT_GE(mem.evNames_, nChar);
+    EXPECT_LE(mem.evNames_, nChar + nEvent * sizeof(Domino::EvNameView) * 2 + EvNameStore::MAX_CHUNK);  // req: 1 copy
+    EXPECT_GT(mem.evIndex_, 0u);
+    EXPECT_EQ(mem.evNames_ + mem.evIndex_ + mem.edges_ + mem.perEvent_, mem.total());
+
+    PARA_DOM->freeze();
+    EXPECT_LT(PARA_DOM->memFootprint().evIndex_, mem.evIndex_);                           // req: frozen smaller
+    EXPECT_EQ(999u, PARA_DOM->getEventBy("/o-ran-hw:hardware/component[name=ru-999]/state/oper-state"));
+}
+
+#define SHARE_TOPO
+// ***********************************************************************************************
+// req: many instances share 1 topology, each w/ own states
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_shareTopo_ownStates)
+{
+    PARA_DOM->setPrev("e2", {{"e1", true}, {"e0", false}});
+    TypeParam inst;
+    EXPECT_TRUE(inst.shareTopo(*PARA_DOM));
+    EXPECT_TRUE(inst.sharedTopo());
+    EXPECT_EQ(PARA_DOM->getEventBy("e2"), inst.getEventBy("e2"));  // req: same topology
+
+    inst.setState({{"e1", true}});
+    EXPECT_TRUE(inst.state("e2"));        // req: deduce as template
+    EXPECT_FALSE(PARA_DOM->state("e1"));  // req: own states
+    EXPECT_FALSE(PARA_DOM->state("e2"));
+    EXPECT_EQ("e1==false", PARA_DOM->whyFalse("e2"));
+}
+TYPED_TEST_P(DominoTest, shareTopo_copyOnWrite)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+
+    inst.setPrev("e2", {{"e1", true}});  // req: inst edits its own copy
+    EXPECT_FALSE(inst.sharedTopo());
+    EXPECT_FALSE(PARA_DOM->sharedTopo());
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("e2"));  // req: template unchanged
+    EXPECT_EQ(2u, PARA_DOM->nEvent());
+
+    TypeParam inst2;
+    inst2.shareTopo(*PARA_DOM);
+    PARA_DOM->setPrev("e1", {{"e3", true}});  // req: template edit not impact inst2
+    inst2.setState({{"e0", true}});
+    EXPECT_TRUE(inst2.state("e1"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, inst2.getEventBy("e3"));
+}
+TYPED_TEST_P(DominoTest, shareTopo_frozen)
+{
+    for (size_t idx = 1; idx < 100; ++idx)
+        PARA_DOM->setPrev("/a/b[" + std::to_string(idx) + "]", {{"/a/b[" + std::to_string(idx - 1) + "]", true}});
+    PARA_DOM->freeze();
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    EXPECT_TRUE(inst.frozen());  // req: share frozen too
+
+    inst.setState({{"/a/b[0]", true}});
+    EXPECT_TRUE(inst.state("/a/b[99]"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, inst.setPrev("/a/b[0]", {{"x", true}}));  // req: still frozen
+    EXPECT_TRUE(inst.sharedTopo());
+}
+TYPED_TEST_P(DominoTest, shareTopo_nonEmpty_nok)
+{
+    PARA_DOM->newEvent("e0");
+    TypeParam inst;
+    inst.newEvent("e1");
+    EXPECT_FALSE(inst.shareTopo(*PARA_DOM));  // req: not mix 2 topologies
+    EXPECT_FALSE(inst.sharedTopo());
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, inst.getEventBy("e0"));
+}
+
+#define PARALLEL
+// ***********************************************************************************************
+// req: disjoint components deduced in parallel, same result as serial
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_parallel_sameAsSerial)
+{
+    const size_t nComp = 8;
+    const size_t nEvPerComp = 100;
+    setupComps(*PARA_DOM, nComp, nEvPerComp);
+    TypeParam serial;
+    setupComps(serial, nComp, nEvPerComp);
+
+    PARA_DOM->setParallel(4, 1);
+    PARA_DOM->setState(compRoots(nComp));
+    serial.setState(compRoots(nComp));
+    for (size_t comp = 0; comp < nComp; ++comp)
+    {
+        for (size_t idx = 0; idx < nEvPerComp; ++idx)
+        {
+            const auto evName = "c" + std::to_string(comp) + "/e" + std::to_string(idx);
+            EXPECT_EQ(serial.state(evName), PARA_DOM->state(evName)) << evName;
+            EXPECT_EQ(serial.whyFalse(evName), PARA_DOM->whyFalse(evName)) << evName;  // req: counters same
+        }
+    }
+    EXPECT_TRUE(PARA_DOM->state("c0/e99"));   // req: deduced to leaf
+    EXPECT_FALSE(PARA_DOM->state("c1/e99"));  // req: false prev respected
+}
+TYPED_TEST_P(DominoTest, nComponent_incremental)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    PARA_DOM->setPrev("e3", {{"e2", false}});
+    EXPECT_EQ(2u, PARA_DOM->nComponent());
+
+    PARA_DOM->setPrev("e3", {{"e1", true}});  // req: merge
+    EXPECT_EQ(1u, PARA_DOM->nComponent());
+    PARA_DOM->newEvent("alone");
+    EXPECT_EQ(2u, PARA_DOM->nComponent());
+
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    EXPECT_EQ(2u, inst.nComponent());  // req: part of topology
+}
+
+#define RETRACT
+// ***********************************************************************************************
+// req: opt-in T->F cascade, derived tiles follow inputs (rollback/retry)
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_retract_cascade)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setPrev("rollback", {{"e1", false}, {"started", true}});
+    PARA_DOM->setRetract(true);
+    PARA_DOM->setState({{"started", true}});
+    EXPECT_TRUE(PARA_DOM->state("rollback"));
+
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+    EXPECT_FALSE(PARA_DOM->state("rollback"));  // req: false prev fails -> fall
+
+    PARA_DOM->setState({{"e0", false}});
+    EXPECT_FALSE(PARA_DOM->state("e1"));        // req: cascade along next_
+    EXPECT_FALSE(PARA_DOM->state("e2"));
+    EXPECT_TRUE(PARA_DOM->state("rollback"));   // req: false-waiting tile re-deduced
+    EXPECT_TRUE(PARA_DOM->state("started"));    // req: input w/o prev untouched
+    EXPECT_EQ("e0==false", PARA_DOM->whyFalse("e1"));
+
+    PARA_DOM->setState({{"e0", true}});         // req: retry
+    EXPECT_TRUE(PARA_DOM->state("e2"));
+    EXPECT_FALSE(PARA_DOM->state("rollback"));
+}
+TYPED_TEST_P(DominoTest, retract_off_byDefault)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    EXPECT_FALSE(PARA_DOM->retract());
+    PARA_DOM->setState({{"e0", true}});
+    PARA_DOM->setState({{"e0", false}});
+    EXPECT_TRUE(PARA_DOM->state("e1"));  // req: legacy, derived stays
+}
+TYPED_TEST_P(DominoTest, retract_byNewPrev_andDiamond)
+{
+    PARA_DOM->setPrev("l", {{"top", true}});
+    PARA_DOM->setPrev("r", {{"top", true}});
+    PARA_DOM->setPrev("bottom", {{"l", true}, {"r", true}});
+    PARA_DOM->setRetract(true);
+    PARA_DOM->setState({{"top", true}});
+    EXPECT_TRUE(PARA_DOM->state("bottom"));
+
+    PARA_DOM->setPrev("bottom", {{"gate", true}});  // req: new unsatisfied prev also retracts
+    EXPECT_FALSE(PARA_DOM->state("bottom"));
+    PARA_DOM->setState({{"gate", true}});
+    EXPECT_TRUE(PARA_DOM->state("bottom"));
+
+    PARA_DOM->setState({{"top", false}});  // req: diamond falls once
+    EXPECT_FALSE(PARA_DOM->state("l"));
+    EXPECT_FALSE(PARA_DOM->state("bottom"));
+}
+
+#define K_OF_N
+// ***********************************************************************************************
+// req: OR / k-of-n tile as 1 event (no alias events)
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_orTile)
+{
+    PARA_DOM->setPrev("any link up", {{"link0", true}, {"link1", true}, {"link2", true}});
+    EXPECT_EQ(PARA_DOM->getEventBy("any link up"), PARA_DOM->setNeed("any link up", 1));
+    EXPECT_FALSE(PARA_DOM->state("any link up"));
+    EXPECT_EQ("link0==false", PARA_DOM->whyFalse("any link up"));
+
+    PARA_DOM->setState({{"link1", true}});
+    EXPECT_TRUE(PARA_DOM->state("any link up"));  // req: 1 is enough
+    EXPECT_TRUE(PARA_DOM->whyFalse("any link up").empty());
+}
+TYPED_TEST_P(DominoTest, kOfN_tile)
+{
+    PARA_DOM->setPrev("3 of 5 ready", {{"p0", true}, {"p1", true}, {"p2", true}, {"p3", true}, {"abort", false}});
+    PARA_DOM->setNeed("3 of 5 ready", 3);
+    EXPECT_FALSE(PARA_DOM->state("3 of 5 ready"));  // only abort==false satisfied
+
+    PARA_DOM->setState({{"p3", true}});
+    EXPECT_FALSE(PARA_DOM->state("3 of 5 ready"));
+    PARA_DOM->setState({{"p0", true}});
+    EXPECT_TRUE(PARA_DOM->state("3 of 5 ready"));   // req: k reached
+
+    PARA_DOM->setRetract(true);
+    PARA_DOM->setState({{"abort", true}});
+    EXPECT_FALSE(PARA_DOM->state("3 of 5 ready"));  // req: retract below k
+    PARA_DOM->setState({{"p2", true}});
+    EXPECT_TRUE(PARA_DOM->state("3 of 5 ready"));
+    PARA_DOM->setNeed("3 of 5 ready", 0);           // req: back to AND
+    EXPECT_FALSE(PARA_DOM->state("3 of 5 ready"));
+}
+TYPED_TEST_P(DominoTest, need_frozen_nok)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}, {"x", true}});
+    PARA_DOM->freeze();
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setNeed("e1", 1));  // req: topology fixed
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_FALSE(PARA_DOM->state("e1"));
+}
+TYPED_TEST_P(DominoTest, need_noPrev_keepState)
+{
+    EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->setNeed("root", 0));
+    EXPECT_FALSE(PARA_DOM->state("root"));  // req: not forced true
+
+    PARA_DOM->setState({{"root", true}});
+    PARA_DOM->setNeed("root", 0);
+    EXPECT_TRUE(PARA_DOM->state("root"));   // req: nor forced false
+}
+TYPED_TEST_P(DominoTest, need_overNPrev_nok)
+{
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setNeed("root", 1));  // req: no prev, never true
+    PARA_DOM->setPrev("2of2", {{"a", true}, {"b", true}});
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setNeed("2of2", 3));
+    EXPECT_EQ(PARA_DOM->getEventBy("2of2"), PARA_DOM->setNeed("2of2", 2));
+
+    PARA_DOM->setState({{"a", true}, {"b", true}});
+    EXPECT_TRUE(PARA_DOM->state("2of2"));
+}
+
+#define MOUNT
+// ***********************************************************************************************
+// req: child Domino mounted as 1 tile of parent
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_mount_childDone_asTile)
+{
+    TypeParam ru;  // child, built & frozen independently
+    ru.setPrev("sw ready", {{"download", true}});
+    ru.setPrev("done", {{"sw ready", true}, {"cfg ready", true}});
+    ru.freeze();
+    EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->mount("ru0 done", ru, "done"));
+    PARA_DOM->setPrev("site done", {{"ru0 done", true}, {"bbu done", true}});
+    PARA_DOM->setState({{"bbu done", true}});
+
+    ru.setState({{"download", true}});
+    EXPECT_FALSE(PARA_DOM->state("ru0 done"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("sw ready"));  // req: child's inside not in parent
+    ru.setState({{"cfg ready", true}});
+    EXPECT_TRUE(PARA_DOM->state("ru0 done"));   // req: child's done -> parent's tile
+    EXPECT_TRUE(PARA_DOM->state("site done"));  // req: ripple on in parent
+
+    ru.setState({{"done", false}});
+    EXPECT_FALSE(PARA_DOM->state("ru0 done"));  // req: follow T->F too
+}
+TYPED_TEST_P(DominoTest, mount_initState_unmount)
+{
+    TypeParam child;
+    child.setState({{"done", true}});
+    PARA_DOM->setPrev("next", {{"tile", true}});
+    PARA_DOM->mount("tile", child, "done");
+    EXPECT_TRUE(PARA_DOM->state("next"));  // req: start w/ child's state
+
+    EXPECT_TRUE(PARA_DOM->unmount("tile"));
+    child.setState({{"done", false}});
+    EXPECT_TRUE(PARA_DOM->state("tile"));  // req: no more follow
+    EXPECT_FALSE(PARA_DOM->unmount("tile"));
+}
+TYPED_TEST_P(DominoTest, mount_invalid_or_destructed)
+{
+    TypeParam child;
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->mount("self", *PARA_DOM, "done"));
+    EXPECT_NE(Domino::D_EVENT_FAILED_RET, PARA_DOM->mount("tile", child, "done"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->mount("tile2", child, "done"));   // req: 1 ev to 1 tile
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->mount("tile", child, "other"));
+
+    {
+        TypeParam parent2;
+        parent2.mount("t", child, "other");
+        const auto copied = child;  // req: copy not linked
+    }
+    child.setState({{"other", true}});  // req: parent2 gone, no dangling
+    {
+        TypeParam child2;
+        PARA_DOM->mount("tile3", child2, "done");
+    }
+    EXPECT_FALSE(PARA_DOM->unmount("tile3"));  // req: child gone, auto unmounted
+}
+
+#define RM_EVENT
+// ***********************************************************************************************
+// req: rm per-session tile, reuse its Event, compact() to return mem
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_rmEvent_reuseId_reDeduce)
+{
+    PARA_DOM->setPrev("upgrade done", {{"sw ready", true}, {"session 1", true}});
+    PARA_DOM->setPrev("session 1 end", {{"session 1", true}});
+    PARA_DOM->setState({{"sw ready", true}});
+    const auto nEvent = PARA_DOM->nEvent();
+    const auto event = PARA_DOM->getEventBy("session 1");
+
+    EXPECT_TRUE(PARA_DOM->rmEvent("session 1"));
+    EXPECT_TRUE(PARA_DOM->state("upgrade done"));   // req: its nexts re-deduce w/o it
+    EXPECT_TRUE(PARA_DOM->state("session 1 end"));  // no prev left
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("session 1"));
+    EXPECT_EQ(1u, PARA_DOM->nRemoved());
+
+    EXPECT_EQ(event, PARA_DOM->newEvent("session 2"));  // req: reuse
+    EXPECT_EQ(nEvent, PARA_DOM->nEvent());
+    EXPECT_EQ(0u, PARA_DOM->nRemoved());
+    EXPECT_FALSE(PARA_DOM->state("session 2"));  // req: fresh
+    EXPECT_EQ("", PARA_DOM->whyFalse("session 2"));  // req: no edge left
+    PARA_DOM->setPrev("session 2 end", {{"session 2", true}});
+    EXPECT_FALSE(PARA_DOM->state("session 2 end"));
+}
+TYPED_TEST_P(DominoTest, rmEvent_oldHandle_refusedAfterReuse)
+{
+    const auto hdl = PARA_DOM->newHandle("session 1");
+    EXPECT_TRUE(PARA_DOM->rmEvent("session 1"));
+    const auto hdl2 = PARA_DOM->newHandle("session 2");
+    EXPECT_EQ(hdl.event(), hdl2.event());  // same Event reused
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy(hdl));  // req: not resolve to "session 2"
+    EXPECT_EQ(PARA_DOM->getEventBy("session 2"), PARA_DOM->getEventBy(hdl2));
+    PARA_DOM->setState(hdl, true);
+    EXPECT_FALSE(PARA_DOM->state("session 2"));
+}
+TYPED_TEST_P(DominoTest, rmEvent_trueEvent_andRetract)
+{
+    PARA_DOM->setRetract(true);
+    PARA_DOM->setPrev("1of2", {{"a", true}, {"b", true}});
+    PARA_DOM->setNeed("1of2", 1);
+    PARA_DOM->setPrev("not b", {{"b", false}});
+    PARA_DOM->setState({{"b", true}});
+    EXPECT_TRUE(PARA_DOM->state("1of2"));
+    EXPECT_FALSE(PARA_DOM->state("not b"));
+
+    EXPECT_TRUE(PARA_DOM->rmEvent("b"));
+    EXPECT_FALSE(PARA_DOM->state("1of2"));  // req: lost its only satisfied prev
+    EXPECT_TRUE(PARA_DOM->state("not b"));  // req: no more unsatisfied prev
+}
+TYPED_TEST_P(DominoTest, GOLD_compact_renumber_sameBehavior)
+{
+    for (size_t idx = 0; idx < 100; ++idx)
+    {
+        const auto session = "session " + std::to_string(idx);
+        PARA_DOM->setPrev(session + " done", {{session, true}, {"sw ready", true}});
+    }
+    PARA_DOM->setPrev("all done", {{"session 99 done", true}, {"sw ready", true}});
+    PARA_DOM->setState({{"session 50", true}, {"session 99", true}});
+    const auto hdl = PARA_DOM->newHandle("session 99");
+    const auto memBefore = PARA_DOM->memFootprint();
+    for (size_t idx = 0; idx < 98; ++idx) PARA_DOM->rmEvent("session " + std::to_string(idx) + " done");
+    for (size_t idx = 0; idx < 98; ++idx) PARA_DOM->rmEvent("session " + std::to_string(idx));
+    EXPECT_EQ(1u + 200 + 1, PARA_DOM->nEvent());
+
+    EXPECT_TRUE(PARA_DOM->compact());
+    EXPECT_EQ(1u + 4 + 1, PARA_DOM->nEvent());  // req: dense
+    EXPECT_EQ(0u, PARA_DOM->nRemoved());
+    EXPECT_EQ(1u, PARA_DOM->nComponent());      // req: rebuilt
+    EXPECT_GT(memBefore.total(), PARA_DOM->memFootprint().total());  // req: mem returned
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy(hdl));  // req: old handle refused
+    EXPECT_TRUE(PARA_DOM->state("session 99"));   // req: states kept
+    EXPECT_FALSE(PARA_DOM->state("session 98"));
+    EXPECT_EQ("session 99 done==false", PARA_DOM->whyFalse("all done"));  // req: edges kept
+
+    PARA_DOM->setState({{"sw ready", true}});
+    EXPECT_TRUE(PARA_DOM->state("session 99 done"));
+    EXPECT_TRUE(PARA_DOM->state("all done"));
+    EXPECT_FALSE(PARA_DOM->state("session 98 done"));
+    PARA_DOM->freeze();
+    PARA_DOM->setState({{"session 98", true}});
+    EXPECT_TRUE(PARA_DOM->state("session 98 done"));
+}
+TYPED_TEST_P(DominoTest, compact_nothingRemoved_noop)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    const auto hdl = inst.newHandle("e1");
+
+    EXPECT_TRUE(inst.compact());
+    EXPECT_TRUE(inst.sharedTopo());  // req: not copied
+    EXPECT_EQ(inst.getEventBy("e1"), inst.getEventBy(hdl));  // req: handle still valid
+    inst.setState({{"e0", true}});
+    EXPECT_TRUE(inst.state("e1"));
+}
+TYPED_TEST_P(DominoTest, freeze_compacts_ifRemoved)
+{
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setPrev("e3", {{"e2", true}});
+    PARA_DOM->rmEvent("e1");
+    PARA_DOM->freeze();
+    EXPECT_EQ(2u, PARA_DOM->nEvent());
+    EXPECT_EQ(0u, PARA_DOM->nRemoved());
+    PARA_DOM->setState({{"e2", true}});
+    EXPECT_TRUE(PARA_DOM->state("e3"));
+}
+TYPED_TEST_P(DominoTest, rmEvent_invalid_nok)
+{
+    EXPECT_FALSE(PARA_DOM->rmEvent("not exist"));
+
+    TypeParam child;
+    PARA_DOM->mount("tile", child, "done");
+    EXPECT_FALSE(PARA_DOM->rmEvent("tile"));  // req: unmount 1st
+    EXPECT_FALSE(child.rmEvent("done"));
+
+    PARA_DOM->setState({{"e1", true}});
+    PARA_DOM->freeze();
+    EXPECT_FALSE(PARA_DOM->rmEvent("e1"));
+    EXPECT_FALSE(PARA_DOM->compact());
+    EXPECT_TRUE(PARA_DOM->state("e1"));
+}
+
+#define SNAPSHOT
+// ***********************************************************************************************
+// req: save() & load() into empty Domino = same Domino (warm restart)
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_snapshot_sameBehavior)
+{
+    const auto path = TempDir() + "DominoTest.snapshot";
+    for (const bool frozen : {false, true})
+    {
+        TypeParam orig;
+        setupComps(orig, 5, 40);
+        orig.setPrev("any", {{"c0/e39", true}, {"c1/e39", true}});
+        orig.setNeed("any", 1);
+        orig.setState({{"c2/e0", true}, {"c3/eabort", true}});
+        if (frozen) orig.freeze();
+        ASSERT_TRUE(orig.save(path));
+
+        TypeParam loaded;
+        ASSERT_TRUE(loaded.load(path));
+        EXPECT_EQ(orig.nEvent(), loaded.nEvent());
+        EXPECT_EQ(frozen, loaded.frozen());  // req: frozen as saved
+        EXPECT_EQ(orig.nComponent(), loaded.nComponent());
+        const auto simu = compRoots(5);
+        orig.setState(simu);
+        loaded.setState(simu);  // req: same deduction after load
+        for (auto&& evName : {"c0/e39", "c1/e39", "c2/e11", "c3/e20", "c4/e15", "any"})
+        {
+            EXPECT_EQ(orig.state(evName), loaded.state(evName)) << evName << ", frozen=" << frozen;
+            EXPECT_EQ(orig.whyFalse(evName), loaded.whyFalse(evName)) << evName;
+        }
+        EXPECT_TRUE(loaded.state("any"));
+    }
+    std::remove(path.c_str());
+}
+TYPED_TEST_P(DominoTest, snapshot_loaded_editable)
+{
+    const auto path = TempDir() + "DominoTest.snapshot";
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setState({{"e0", true}});
+    ASSERT_TRUE(PARA_DOM->save(path));
+
+    TypeParam loaded;
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_TRUE(loaded.state("e0"));
+    loaded.setPrev("e3", {{"e2", true}});  // req: can go on setup
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, loaded.setPrev("e1", {{"e3", true}}));  // req: loop check by loaded order
+    loaded.setState({{"e1", true}});
+    EXPECT_TRUE(loaded.state("e3"));
+    std::remove(path.c_str());
+}
+TYPED_TEST_P(DominoTest, snapshot_invalid_nok)
+{
+    const auto path = TempDir() + "DominoTest.snapshot";
+    EXPECT_FALSE(PARA_DOM->load(path + ".notExist"));
+
+    PARA_DOM->setState({{"e1", true}, {"e2", true}});
+    PARA_DOM->rmEvent("e1");
+    EXPECT_FALSE(PARA_DOM->save(path));  // req: compact() 1st
+    PARA_DOM->compact();
+    ASSERT_TRUE(PARA_DOM->save(path));
+
+    EXPECT_FALSE(PARA_DOM->load(path));  // req: only empty Domino
+    Domino16 narrow;
+    EXPECT_FALSE(narrow.load(path));     // req: same Event width
+    EXPECT_EQ(0u, narrow.nEvent());
+
+    TypeParam orig;
+    orig.setPrev("e2", {{"e1", true}});
+    orig.setState({{"e1", true}});
+    const auto e1 = orig.getEventBy("e1");
+    const auto e2 = orig.getEventBy("e2");
+    ASSERT_TRUE(orig.save(path));
+    EXPECT_TRUE(TypeParam().load(path));
+    ASSERT_TRUE(patchSnapshot(path, "ordr", 1, e1));  // req: evOfOrd_ = {e1, e1} not a permutation
+    EXPECT_FALSE(TypeParam().load(path));
+    ASSERT_TRUE(orig.save(path));
+    ASSERT_TRUE(patchSnapshot(path, "nUns", e2, 1));  // req: nUnsatPrev_ not match e1 == true
+    EXPECT_FALSE(TypeParam().load(path));
+    std::remove(path.c_str());
+}
+
+#define JOURNAL
+// ***********************************************************************************************
+// req: openJournal() on same build after crash = states as committed before crash
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_journal_recover_sameStates)
+{
+    const auto path = TempDir() + "DominoTest.journal";
+    std::remove(path.c_str());
+    TypeParam orig;
+    setupComps(orig, 3, 20);
+    ASSERT_TRUE(orig.openJournal(path));
+    orig.setState(compRoots(3));
+    orig.setState({{"c1/eabort", true}, {"c2/e0", false}});  // incl retract/false
+
+    TypeParam restarted;
+    setupComps(restarted, 3, 20);  // same build
+    ASSERT_TRUE(restarted.openJournal(path));
+    for (size_t comp = 0; comp < 3; ++comp)
+    {
+        for (auto&& idx : {"0", "1", "5", "10", "19", "abort"})
+        {
+            const auto evName = "c" + std::to_string(comp) + "/e" + idx;
+            EXPECT_EQ(orig.state(evName), restarted.state(evName)) << evName;
+        }
+    }
+    EXPECT_EQ(orig.whyFalse("c1/e19"), restarted.whyFalse("c1/e19"));  // req: prev count also recovered
+
+    restarted.setState({{"c2/e0", true}});  // req: go on as if no crash
+    orig.setState({{"c2/e0", true}});
+    EXPECT_EQ(orig.state("c2/e19"), restarted.state("c2/e19"));
+    std::remove(path.c_str());
+}
+TYPED_TEST_P(DominoTest, journal_uncommitted_lost)
+{
+    const auto path = TempDir() + "DominoTest.journal";
+    std::remove(path.c_str());
+    TypeParam orig;
+    orig.newEvent("e0");
+    orig.newEvent("e1");
+    ASSERT_TRUE(orig.openJournal(path, 2));  // commit per 2 broadcasts
+    orig.setState({{"e0", true}});
+    orig.setState({{"e1", true}});
+    orig.setState({{"e0", false}});  // not committed yet when "crash"
+
+    TypeParam restarted;
+    restarted.newEvent("e0");
+    restarted.newEvent("e1");
+    ASSERT_TRUE(restarted.openJournal(path));
+    EXPECT_TRUE(restarted.state("e0"));  // req: till last commit
+    EXPECT_TRUE(restarted.state("e1"));
+    std::remove(path.c_str());
+}
+TYPED_TEST_P(DominoTest, GOLD_journal_checkpoint_thenRecover)
+{
+    const auto path = TempDir() + "DominoTest.journal";
+    const auto snapshot = TempDir() + "DominoTest.snapshot";
+    std::remove(path.c_str());
+    TypeParam orig;
+    orig.setPrev("e1", {{"e0", true}});
+    ASSERT_TRUE(orig.openJournal(path));
+    orig.setState({{"e0", true}});
+    orig.setPrev("e2", {{"e1", true}});  // topology change
+    ASSERT_TRUE(orig.checkpoint(snapshot));
+    orig.setState({{"e3", true}});       // new event after checkpoint is not journaled...
+    orig.setPrev("e4", {{"e0", false}});
+    ASSERT_TRUE(orig.checkpoint(snapshot));  // ...till next checkpoint
+    orig.setState({{"e0", false}});
+
+    TypeParam restarted;
+    ASSERT_TRUE(restarted.load(snapshot));
+    ASSERT_TRUE(restarted.openJournal(path));
+    EXPECT_EQ(orig.nEvent(), restarted.nEvent());
+    for (auto&& evName : {"e0", "e1", "e2", "e3", "e4"})
+        EXPECT_EQ(orig.state(evName), restarted.state(evName)) << evName;
+    EXPECT_TRUE(restarted.state("e4"));
+    std::remove(path.c_str());
+    std::remove(snapshot.c_str());
+}
+TYPED_TEST_P(DominoTest, journal_topoChange_compact_recover_nok)
+{
+    const auto path = TempDir() + "DominoTest.journal";
+    const auto snapshot = TempDir() + "DominoTest.snapshot";
+    std::remove(path.c_str());
+    auto&& build = [](TypeParam& aDom, const bool aWithSession)
+    {
+        if (aWithSession) aDom.setPrev("session 1 end", {{"session 1", true}});
+        aDom.setPrev("sw done", {{"sw ready", true}});
+    };
+    TypeParam orig;
+    build(orig, true);
+    ASSERT_TRUE(orig.openJournal(path));
+    EXPECT_TRUE(orig.rmEvent("session 1"));
+    EXPECT_TRUE(orig.compact());  // "sw ready" etc renumbered
+    orig.setState({{"sw ready", true}});
+    orig.commitJournal();
+
+    TypeParam sameBuild;
+    build(sameBuild, true);
+    EXPECT_FALSE(sameBuild.openJournal(path));  // req: records after change target other events
+    EXPECT_FALSE(sameBuild.state("session 1"));
+    EXPECT_FALSE(sameBuild.state("session 1 end"));
+
+    TypeParam newBuild;
+    build(newBuild, false);
+    newBuild.newEvent("session 1 end");
+    EXPECT_FALSE(newBuild.openJournal(path));  // req: header is of topology before change
+
+    ASSERT_TRUE(orig.checkpoint(snapshot));  // req: ok again after checkpoint
+    orig.setState({{"sw ready", false}});
+    TypeParam restarted;
+    ASSERT_TRUE(restarted.load(snapshot));
+    ASSERT_TRUE(restarted.openJournal(path));
+    EXPECT_FALSE(restarted.state("sw ready"));
+    EXPECT_TRUE(restarted.state("sw done"));
+    std::remove(path.c_str());
+    std::remove(snapshot.c_str());
+}
+TYPED_TEST_P(DominoTest, journal_invalid_nok)
+{
+    const auto path = TempDir() + "DominoTest.journal";
+    std::remove(path.c_str());
+    EXPECT_FALSE(PARA_DOM->checkpoint(path + ".snapshot"));  // req: journal 1st
+    EXPECT_FALSE(PARA_DOM->commitJournal());
+
+    PARA_DOM->newEvent("e0");
+    ASSERT_TRUE(PARA_DOM->openJournal(path));
+    EXPECT_FALSE(PARA_DOM->openJournal(path));  // req: already journaled
+    PARA_DOM->setState({{"e0", true}});
+    PARA_DOM->closeJournal();
+
+    TypeParam other;
+    other.newEvent("e0");
+    other.newEvent("e1");
+    EXPECT_FALSE(other.openJournal(path));  // req: other topology
+    EXPECT_FALSE(other.state("e0"));
+    std::remove(path.c_str());
+}
+
+#define LOAD_GRAPH
+// ***********************************************************************************************
+// req: loadGraph() whole graph into empty Domino = newEvent() + setPrev() per event
+// ***********************************************************************************************
+TYPED_TEST_P(DominoTest, GOLD_loadGraph_text)
+{
+    std::istringstream text(
+        "# c = a && !b; d = c; e = !d\n"
+        "5 4\n"
+        "a\n"
+        "b\n"
+        "\n"
+        "c\n"
+        "d\n"
+        "e\n"
+        "0 2 1\n"
+        "1 2 0\n"
+        "2 3 1\n"
+        "3 4 0\n");
+    ASSERT_TRUE(PARA_DOM->loadGraph(text));
+    EXPECT_EQ(5u, PARA_DOM->nEvent());
+    EXPECT_EQ(2u, PARA_DOM->getEventBy("c"));  // req: Event = line order
+    EXPECT_EQ(1u, PARA_DOM->nComponent());
+    EXPECT_TRUE(PARA_DOM->state("e"));         // req: deduced at load
+    EXPECT_EQ("a==false", PARA_DOM->whyFalse("c"));
+
+    PARA_DOM->setState({{"a", true}});
+    EXPECT_TRUE(PARA_DOM->state("d"));
+    EXPECT_TRUE(PARA_DOM->state("e"));  // no retract by default, same as setPrev()
+}
+TYPED_TEST_P(DominoTest, loadGraph_editable)
+{
+    ASSERT_TRUE(PARA_DOM->loadGraph({"e1", "e2", "e3"}, {{0, 1, true}, {1, 2, true}}));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e1", {{"e3", true}}));  // req: loop check by loaded order
+    PARA_DOM->setPrev("e4", {{"e3", true}});  // req: can go on setup
+    PARA_DOM->freeze();
+    PARA_DOM->setState({{"e1", true}});
+    EXPECT_TRUE(PARA_DOM->state("e4"));
+}
+TYPED_TEST_P(DominoTest, loadGraph_invalid_nok)
+{
+    using GraphEdges = std::vector<typename TypeParam::GraphEdge>;
+    EXPECT_FALSE(PARA_DOM->loadGraph({"a", "a"}, GraphEdges()));                     // req: dup EvName
+    EXPECT_FALSE(PARA_DOM->loadGraph({"a", "b"}, {{0, 2, true}}));                   // req: out of range
+    EXPECT_FALSE(PARA_DOM->loadGraph({"a", "b"}, {{1, 1, true}}));                   // req: self
+    EXPECT_FALSE(PARA_DOM->loadGraph({"a", "b"}, {{0, 1, true}, {0, 1, true}}));     // req: dup edge
+    EXPECT_FALSE(PARA_DOM->loadGraph({"a", "b", "c"}, {{0, 1, true}, {1, 2, true}, {2, 0, false}}));  // req: loop
+    for (auto&& bad : {"x 0\n", "2 0\na\n", "2 1\na\nb\n0 1 2\n", "2 1\na\nb\n0 1 1 0\n", "1 0\na\nb\n"})
+    {
+        std::istringstream text(bad);
+        EXPECT_FALSE(PARA_DOM->loadGraph(text)) << bad;  // req: bad header/num/field/extra line
+    }
+    EXPECT_EQ(0u, PARA_DOM->nEvent());  // req: nothing changed
+
+    PARA_DOM->newEvent("a");
+    EXPECT_FALSE(PARA_DOM->loadGraph({"b"}, GraphEdges()));  // req: only empty Domino
+    EXPECT_EQ(1u, PARA_DOM->nEvent());
+}
+TYPED_TEST_P(DominoTest, reserve_sameBehavior)
+{
+    const auto before = PARA_DOM->memFootprint();
+    PARA_DOM->reserve(1000, 3000);
+    EXPECT_GT(PARA_DOM->memFootprint().perEvent_, before.perEvent_);  // req: pre-sized
+    EXPECT_GT(PARA_DOM->memFootprint().edges_, before.edges_);
+    EXPECT_EQ(0u, PARA_DOM->nEvent());
+
+    setupComps(*PARA_DOM, 2, 100);
+    PARA_DOM->setState(compRoots(2));
+    EXPECT_TRUE(PARA_DOM->state("c0/e99"));
+}
+
 #define BROADCAST_STATE
 // ***********************************************************************************************
 // - req: forward broadcast
@@ -190,11 +1090,97 @@ TYPED_TEST_P(DominoTest, GOLD_broadcast_only_allPrev_satisfied)
     EXPECT_TRUE(PARA_DOM->state("e1"));
     EXPECT_TRUE(PARA_DOM->state("e4"));
 }
+TYPED_TEST_P(DominoTest, fanIn_broadcast_whenLastPrev_satisfied)
+{
+    Domino::SimuEvents cells;
+    for (size_t idx = 0; idx < 100; ++idx) cells["cell" + std::to_string(idx)] = true;
+    cells["abort"] = false;
+    PARA_DOM->setPrev("all cells ready", cells);
+
+    for (size_t idx = 0; idx < 100; ++idx)
+    {
+        EXPECT_FALSE(PARA_DOM->state("all cells ready"));  // req: not till all satisfied
+        PARA_DOM->setState({{"cell" + std::to_string(idx), true}});
+    }
+    EXPECT_TRUE(PARA_DOM->state("all cells ready"));       // req: last prev satisfied
+
+    PARA_DOM->setState({{"cell7", false}});
+    EXPECT_EQ("cell7==false", PARA_DOM->whyFalse("all cells ready"));  // req: track unsatisfied
+    PARA_DOM->setState({{"abort", true}, {"cell7", true}});
+    EXPECT_EQ("abort==true", PARA_DOM->whyFalse("all cells ready"));
+    PARA_DOM->setState({{"abort", false}});
+    EXPECT_TRUE(PARA_DOM->whyFalse("all cells ready").empty());
+}
+TYPED_TEST_P(DominoTest, deepChain_broadcast_noStackOverflow)
+{
+    const size_t nEvent = 10'000;
+    for (size_t idx = 1; idx < nEvent; ++idx)
+        PARA_DOM->setPrev("e" + std::to_string(idx), {{"e" + std::to_string(idx - 1), true}});
+
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_TRUE(PARA_DOM->state("e" + std::to_string(nEvent - 1)));  // req: broadcast to end
+}
+TYPED_TEST_P(DominoTest, stackedDiamonds_broadcast_noRevisit)
+{
+    // e0 -> (l1, r1) -> e1 -> (l2, r2) -> e2 ...: recursion would revisit 2^nDiamond times
+    const size_t nDiamond = 40;
+    for (size_t idx = 1; idx <= nDiamond; ++idx)
+    {
+        const auto top = "e" + std::to_string(idx - 1);
+        const auto idxStr = std::to_string(idx);
+        PARA_DOM->setPrev("l" + idxStr, {{top, true}});
+        PARA_DOM->setPrev("r" + idxStr, {{top, true}});
+        PARA_DOM->setPrev("e" + idxStr, {{"l" + idxStr, true}, {"r" + idxStr, true}});
+    }
+
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_TRUE(PARA_DOM->state("e" + std::to_string(nDiamond)));  // req: broadcast to end (quickly)
+}
+TYPED_TEST_P(DominoTest, setPrev_byView_or_SimuEvents)
+{
+    const std::string_view e3("e3");
+    PARA_DOM->setPrev(e3, {{"e1", true}});
+    const Domino::SimuEvents simuPrev{{"e2", false}};
+    PARA_DOM->setPrev(e3, simuPrev);  // req: legacy SimuEvents still ok, & add more prev
+
+    PARA_DOM->setState("e1", true);
+    EXPECT_TRUE(PARA_DOM->state(e3));
+}
 TYPED_TEST_P(DominoTest, prevSelf_is_invalid)
 {
     EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e1", {{"e1", true}}));
     EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e1", {{"e1", false}}));
 }
+TYPED_TEST_P(DominoTest, GOLD_indirectLoop_is_invalid)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    PARA_DOM->setPrev("e2", {{"e1", false}});
+    PARA_DOM->setPrev("e3", {{"e2", true}});
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e0", {{"e3", true}}));              // req: loop
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e1", {{"x", true}, {"e2", true}}));  // req: all refused
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->getEventBy("x"));
+    EXPECT_EQ(PARA_DOM->getEventBy("e0"), PARA_DOM->setPrev("e0", {{"x", true}}));              // req: non-loop ok
+
+    PARA_DOM->setState({{"x", true}});
+    EXPECT_TRUE(PARA_DOM->state("e1"));  // req: refused edges not impact
+    EXPECT_EQ("e1==true", PARA_DOM->whyFalse("e2"));  // (e2 & e3 deduced true at setPrev)
+}
+TYPED_TEST_P(DominoTest, reverseBuild_keepTopoOrder)
+{
+    const size_t nEvent = 1000;  // built from end, so each setPrev() reorders
+    for (size_t idx = nEvent - 1; idx > 0; --idx)
+        PARA_DOM->setPrev("e" + std::to_string(idx), {{"e" + std::to_string(idx - 1), true}});
+    PARA_DOM->setPrev("e500", {{"side", true}});
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("side", {{"e999", true}}));  // req: long loop
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPrev("e0", {{"e999", true}}));
+
+    PARA_DOM->freeze();  // compact by kept order
+    PARA_DOM->setState({{"e0", true}});
+    EXPECT_FALSE(PARA_DOM->state("e500"));
+    PARA_DOM->setState({{"side", true}});
+    EXPECT_TRUE(PARA_DOM->state("e" + std::to_string(nEvent - 1)));
+}
 
 #define WHY_FALSE
 // ***********************************************************************************************
@@ -234,11 +1220,62 @@ REGISTER_TYPED_TEST_SUITE_P(DominoTest
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
     , noID_for_not_exist_EvName
     , stateFalse_for_not_exist_EvName
+    , copy_keep_EvName_index
     , GOLD_setState_thenGetIt
+    , setState_byView
+    , GOLD_handle_sameAs_EvName
+    , invalidHandle_nok
+    , GOLD_literal_sameAs_EvName
+    , noHashCollision_forManyEvName
+    , GOLD_freeze_sameBehavior
+    , freeze_refuseSetup_tillThaw
+    , evName_storedOnce
+    , GOLD_shareTopo_ownStates
+    , shareTopo_copyOnWrite
+    , shareTopo_frozen
+    , shareTopo_nonEmpty_nok
+    , GOLD_parallel_sameAsSerial
+    , nComponent_incremental
+    , GOLD_retract_cascade
+    , retract_off_byDefault
+    , retract_byNewPrev_andDiamond
+    , GOLD_orTile
+    , kOfN_tile
+    , need_frozen_nok
+    , need_noPrev_keepState
+    , need_overNPrev_nok
+    , GOLD_mount_childDone_asTile
+    , mount_initState_unmount
+    , mount_invalid_or_destructed
+    , GOLD_rmEvent_reuseId_reDeduce
+    , rmEvent_oldHandle_refusedAfterReuse
+    , rmEvent_trueEvent_andRetract
+    , GOLD_compact_renumber_sameBehavior
+    , compact_nothingRemoved_noop
+    , freeze_compacts_ifRemoved
+    , rmEvent_invalid_nok
+    , GOLD_snapshot_sameBehavior
+    , snapshot_loaded_editable
+    , snapshot_invalid_nok
+    , GOLD_journal_recover_sameStates
+    , journal_uncommitted_lost
+    , GOLD_journal_checkpoint_thenRecover
+    , journal_topoChange_compact_recover_nok
+    , journal_invalid_nok
+    , GOLD_loadGraph_text
+    , loadGraph_editable
+    , loadGraph_invalid_nok
+    , reserve_sameBehavior
     , GOLD_broadcast_trueState
     , immediate_broadcast
     , GOLD_broadcast_only_allPrev_satisfied
+    , fanIn_broadcast_whenLastPrev_satisfied
+    , deepChain_broadcast_noStackOverflow
+    , stackedDiamonds_broadcast_noRevisit
+    , setPrev_byView_or_SimuEvents
     , prevSelf_is_invalid
+    , GOLD_indirectLoop_is_invalid
+    , reverseBuild_keepTopoOrder
     , GOLD_multi_retOne
     , trueEvent_retEmpty
     , eventWithoutPrev_retEmpty
@@ -246,4 +1283,156 @@ REGISTER_TYPED_TEST_SUITE_P(DominoTest
 );
 using AnyDom = Types<Domino, MinDatDom, MinHdlrDom, MinMhdlrDom, MinPriDom, MinFreeDom, MaxNofreeDom, MaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, DominoTest, AnyDom);
+
+#define EVENT_WIDTH
+// ***********************************************************************************************
+// req: narrow Event (eg uint16_t) for whole Domino family, same behavior but less mem
+// ***********************************************************************************************
+template<class aParaDom>
+struct DominoWidthTest : public Test
+{
+    UtInitObjAnywhere utInit_;  // MsgSelf for hdlr
+    aParaDom dom_;
+};
+TYPED_TEST_SUITE_P(DominoWidthTest);
+
+TYPED_TEST_P(DominoWidthTest, GOLD_narrowEvent_sameBehavior)
+{
+    auto&& dom = this->dom_;
+    EXPECT_EQ(0u, dom.setPrev("e1", {{"e0", true}}));
+    dom.setPrev("e2", {{"e1", true}, {"e3", false}});
+    EXPECT_EQ("e0==false", dom.whyFalse("e1"));
+
+    dom.setState({{"e0", true}});                                      // req: broadcast
+    EXPECT_TRUE(dom.state("e2"));
+    dom.setState({{"e3", true}});
+    EXPECT_EQ("e3==true", dom.whyFalse(dom.newHandle("e2")) + dom.whyFalse("e1"));
+    EXPECT_EQ(TypeParam::D_EVENT_FAILED_RET, dom.getEventBy("not exist"));
+}
+TYPED_TEST_P(DominoWidthTest, narrowEvent_lessMem)
+{
+    Domino wide;
+    auto&& narrow = this->dom_;
+    for (size_t idx = 1; idx < 1000; ++idx)
+    {
+        wide.setPrev("e" + std::to_string(idx), {{"e" + std::to_string(idx - 1), true}});
+        narrow.setPrev("e" + std::to_string(idx), {{"e" + std::to_string(idx - 1), true}});
+    }
+    EXPECT_LT(narrow.memFootprint().edges_, wide.memFootprint().edges_);      // req: less mem
+    EXPECT_LT(narrow.memFootprint().perEvent_, wide.memFootprint().perEvent_);
+
+    narrow.setState({{"e0", true}});
+    EXPECT_TRUE(narrow.state("e999"));
+}
+REGISTER_TYPED_TEST_SUITE_P(DominoWidthTest
+    , GOLD_narrowEvent_sameBehavior
+    , narrowEvent_lessMem
+);
+using Max16Dom = WbasicDatDom<MultiHdlrDomino<DataDomino<FreeHdlrDomino<PriDomino<HdlrDomino<Domino16> > > > > >;
+using AnyWidthDom = Types<Domino16, Domino32, Max16Dom>;
+INSTANTIATE_TYPED_TEST_SUITE_P(PARA, DominoWidthTest, AnyWidthDom);
+
+// ***********************************************************************************************
+TEST(DominoWidthOverflowTest, newEvent_refuse_beyondMax)
+{
+    Domino16 dom;
+    for (size_t idx = 0; idx <= Domino16::MAX_EVENT; ++idx) dom.newEvent("e" + std::to_string(idx));
+    EXPECT_EQ(Domino16::MAX_EVENT, dom.getEventBy("e" + std::to_string(Domino16::MAX_EVENT)));  // req: max ok
+
+    EXPECT_EQ(Domino16::D_EVENT_FAILED_RET, dom.newEvent("1 more"));                         // req: overflow nok
+    EXPECT_EQ(Domino16::D_EVENT_FAILED_RET, dom.setPrev("2 more", {{"e0", true}}));
+    dom.setState({{"3 more", true}});
+    EXPECT_EQ(size_t(Domino16::MAX_EVENT) + 1, dom.nEvent());                              // req: no wrap
+    EXPECT_FALSE(dom.state("1 more"));
+}
+
+// ***********************************************************************************************
+struct RecDom : public Domino  // record effect() order
+{
+    std::vector<EvName> fired_;
+    void effect(const Event aEv) override { fired_.emplace_back(evName(aEv)); }
+};
+struct RmInEffectDom : public Domino  // sync hdlr that edits topology
+{
+    EvName on_;
+    std::vector<bool> ok_;  // rmEvent(), compact()
+    void effect(const Event aEv) override
+    {
+        if (evName(aEv) == on_) ok_ = {rmEvent("a"), compact()};
+    }
+};
+TEST(DominoRmEventTest, inEffect_nok)
+{
+    for (auto&& on : {"a", "last"})  // setState()'s own ev, or last candidate (worklist already empty)
+    {
+        RmInEffectDom dom;
+        dom.on_ = on;
+        dom.setPrev("last", {{"a", true}});
+        dom.setState({{"a", true}});
+        EXPECT_EQ(std::vector<bool>({false, false}), dom.ok_) << on;  // req: not mid broadcast
+        EXPECT_TRUE(dom.state("last")) << on;
+        EXPECT_TRUE(dom.rmEvent("a")) << on;  // ok after
+    }
+}
+struct NestedSetDom : public Domino  // sync hdlr that setState()
+{
+    void effect(const Event aEv) override
+    {
+        if (evName(aEv) == "a") setState({{"x", true}});
+    }
+};
+TEST(DominoNestedSetTest, inputsKept_acrossNestedSetState)
+{
+    NestedSetDom dom;
+    dom.setPrev("a2", {{"a", true}});
+    dom.setPrev("b2", {{"b", true}});
+    dom.setPrev("x2", {{"x", true}});
+    dom.freeze();
+
+    dom.setState({{"a", true}, {"new", true}, {"b", true}});  // "new" refused since frozen
+    EXPECT_TRUE(dom.state("x2"));  // req: nested broadcast
+    EXPECT_TRUE(dom.state("a2"));  // req: outer inputs not lost by nested
+    EXPECT_TRUE(dom.state("b2"));
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, dom.getEventBy("new"));
+}
+TEST(DominoParallelTest, GOLD_effectOrder_sameAsSerial)
+{
+    const size_t nComp = 8;
+    RecDom parallel;
+    setupComps(parallel, nComp, 100);
+    parallel.setParallel(3, 1);  // req: more comps than threads
+    RecDom serial;
+    setupComps(serial, nComp, 100);
+
+    parallel.setState(compRoots(nComp));
+    serial.setState(compRoots(nComp));
+    EXPECT_EQ(serial.fired_, parallel.fired_);  // req: deterministic merge = serial order
+    EXPECT_LT(nComp * 10, parallel.fired_.size());
+}
+TEST(DominoParallelTest, copy_ownWorkers_sameResult)
+{
+    const size_t nComp = 8;
+    RecDom serial;
+    setupComps(serial, nComp, 20);
+    serial.setState(compRoots(nComp));
+
+    RecDom parallel;
+    setupComps(parallel, nComp, 20);
+    parallel.setParallel(4, 1);
+    RecDom copied(parallel);  // req: copy w/o workers works too (created on need)
+    copied.setState(compRoots(nComp));
+    EXPECT_EQ(serial.fired_, copied.fired_);
+    parallel.setState(compRoots(nComp));  // req: own workers still ok
+    EXPECT_EQ(serial.fired_, parallel.fired_);
+}
+TEST(DominoParallelTest, oneComp_or_smallBatch_serial)
+{
+    RecDom dom;
+    dom.setPrev("e1", {{"e0", true}});
+    dom.setPrev("e2", {{"e1", true}, {"x", true}});
+    dom.setParallel(4);  // default minCand
+
+    dom.setState({{"e0", true}, {"x", true}});
+    EXPECT_EQ(std::vector<Domino::EvName>({"e0", "x", "e1", "e2"}), dom.fired_);
+}
 }  // namespace
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+
+#include "DominoWorkload.hpp"
+#include "UtInitObjAnywhere.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct DominoWorkloadTest : public TestWithParam<WorkloadCfg::Shape>
+{
+    WorkloadCfg cfg(const size_t aNEvent) const
+    {
+        WorkloadCfg cfg;
+        cfg.shape = GetParam();
+        cfg.nEvent = aNEvent;
+        cfg.fanIn = 50;  // several groups even in small UT
+        return cfg;
+    }
+};
+INSTANTIATE_TEST_SUITE_P(, DominoWorkloadTest, Values(
+    WorkloadCfg::RANDOM_DAG, WorkloadCfg::PHASED_PIPELINE, WorkloadCfg::FAN_IN_BARRIER));
+
+bool operator==(const DominoWorkload::Edge& aL, const DominoWorkload::Edge& aR)
+{
+    return aL.prev == aR.prev && aL.next == aR.next && aL.prevState == aR.prevState;
+}
+bool operator==(const DominoWorkload::Stimulus& aL, const DominoWorkload::Stimulus& aR)
+{
+    return aL.event == aR.event && aL.state == aR.state;
+}
+
+#define GEN
+// ***********************************************************************************************
+TEST_P(DominoWorkloadTest, GOLD_sameSeed_sameWorkload)
+{
+    auto cfg = this->cfg(3000);
+    cfg.falsePct = 20;
+    const auto wl = genWorkload(cfg);
+    const auto again = genWorkload(cfg);
+    EXPECT_EQ(wl.edges, again.edges);  // req: deterministic
+    EXPECT_EQ(wl.hdlrEvents, again.hdlrEvents);
+    EXPECT_EQ(wl.stimuli, again.stimuli);
+    EXPECT_EQ(wl.stepBegins, again.stepBegins);
+
+    ++cfg.seed;
+    EXPECT_NE(wl.stimuli, genWorkload(cfg).stimuli);  // req: seed matters
+}
+TEST_P(DominoWorkloadTest, GOLD_exactNEvent_inTopoOrder)
+{
+    for (size_t nEvent : {0, 1, 7, 1000, 12345})
+    {
+        const auto wl = genWorkload(cfg(nEvent));
+        EXPECT_EQ(nEvent, wl.nEvent);
+        std::vector<bool> isInput(nEvent, true);
+        for (auto&& edge : wl.edges)
+        {
+            EXPECT_LT(edge.prev, edge.next) << nEvent;  // req: DAG & ev id = topo order
+            ASSERT_LT(edge.next, nEvent);
+            isInput[edge.next] = false;
+        }
+
+        std::vector<size_t> nStimulus(nEvent);
+        for (auto&& stimulus : wl.stimuli)
+        {
+            EXPECT_TRUE(isInput[stimulus.event]);  // req: stimulate input only
+            ++nStimulus[stimulus.event];
+        }
+        for (size_t ev = 0; ev < nEvent; ++ev)
+            EXPECT_EQ(isInput[ev] ? 1u : 0u, nStimulus[ev]) << ev;  // req: each input once (falsePct=0)
+        EXPECT_EQ(wl.nInput(), wl.stimuli.size());
+    }
+}
+TEST_P(DominoWorkloadTest, stepSize)
+{
+    auto cfg = this->cfg(1000);
+    cfg.stepSize = 10;
+    const auto wl = genWorkload(cfg);
+    EXPECT_EQ((wl.nInput() + 9) / 10, wl.nStep());  // req: stimuli per setState()
+}
+TEST_P(DominoWorkloadTest, falsePct_retractInputs)
+{
+    auto cfg = this->cfg(1000);
+    cfg.falsePct = 100;
+    const auto wl = genWorkload(cfg);
+
+    EXPECT_EQ(2 * wl.nInput(), wl.stimuli.size());  // req: all retracted
+    for (auto&& edge : wl.edges) EXPECT_FALSE(edge.prevState);  // req: all need prev=false
+}
+
+#define REPLAY
+// ***********************************************************************************************
+TEST_P(DominoWorkloadTest, GOLD_replay_allTrue_callAllHdlr)
+{
+    UtInitObjAnywhere utInit;
+    auto cfg = this->cfg(2000);
+    cfg.stepSize = 3;
+    const auto wl = genWorkload(cfg);
+
+    MaxDom dom;
+    loadWorkload(dom, wl);
+    EXPECT_EQ(wl.nEvent, dom.nEvent());
+    size_t nCalled = 0;
+    setWorkloadHdlr(dom, wl, [&nCalled](){ ++nCalled; });
+    replayWorkload(dom, wl);
+
+    for (size_t ev = 0; ev < wl.nEvent; ++ev)
+        EXPECT_TRUE(dom.state(DominoWorkload::evName(ev))) << ev;  // req: all inputs true -> all true
+    EXPECT_EQ(wl.hdlrEvents.size(), nCalled);
+}
+TEST_P(DominoWorkloadTest, replay_mixed_inputsAsLastStimulus)
+{
+    auto cfg = this->cfg(2000);
+    cfg.falsePct = 30;
+    const auto wl = genWorkload(cfg);
+
+    Domino dom;
+    loadWorkload(dom, wl);
+    replayWorkload(dom, wl);
+
+    std::vector<bool> expect(wl.nEvent);  // inputs' final state
+    for (auto&& stimulus : wl.stimuli) expect[stimulus.event] = stimulus.state;
+    for (auto&& stimulus : wl.stimuli)
+        EXPECT_EQ(expect[stimulus.event], dom.state(DominoWorkload::evName(stimulus.event)));  // req: replayed
+}
+
+#define LOAD_GRAPH
+// ***********************************************************************************************
+TEST_P(DominoWorkloadTest, GOLD_loadGraph_sameAs_setPrevPerEvent)
+{
+    auto cfg = this->cfg(2000);
+    cfg.falsePct = 30;
+    cfg.stepSize = 50;
+    const auto wl = genWorkload(cfg);
+
+    Domino bulk;
+    EXPECT_TRUE(loadWorkloadGraph(bulk, wl));
+    Domino dom;  // setPrev() per event w/ all its prevs (edges are grouped by next)
+    for (size_t ev = 0; ev < wl.nEvent; ++ev) dom.newEvent(DominoWorkload::evName(ev));
+    for (size_t idx = 0; idx < wl.edges.size();)
+    {
+        const auto next = wl.edges[idx].next;
+        Domino::SimuEvents prevs;
+        for (; idx < wl.edges.size() && wl.edges[idx].next == next; ++idx)
+            prevs[DominoWorkload::evName(wl.edges[idx].prev)] = wl.edges[idx].prevState;
+        dom.setPrev(DominoWorkload::evName(next), prevs);
+    }
+    EXPECT_EQ(dom.nEvent(), bulk.nEvent());
+    EXPECT_EQ(dom.nComponent(), bulk.nComponent());  // req: components tracked
+
+    for (size_t step = 0; step <= wl.nStep(); ++step)
+    {
+        for (size_t ev = 0; ev < wl.nEvent; ++ev)
+        {
+            const auto evName = DominoWorkload::evName(ev);
+            ASSERT_EQ(dom.state(evName), bulk.state(evName)) << "step=" << step << ", ev=" << ev;  // req: same
+        }
+        if (step == wl.nStep()) break;
+        replayStep(dom, wl, step);
+        replayStep(bulk, wl, step);
+    }
+}
+}  // namespace
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <cstdio>  // remove
+#include <gtest/gtest.h>
+#include <string>
+
+#include "EdgeCsr.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct EdgeCsrTest : public Test
+{
+    EdgeCsr csr_;
+};
+
+#define EDGE
+// ***********************************************************************************************
+TEST_F(EdgeCsrTest, GOLD_edge_packs_node_and_flag)
+{
+    EXPECT_EQ(5u, EdgeCsr::nodeOf(EdgeCsr::toEdge(5, true)));
+    EXPECT_TRUE(EdgeCsr::flagOf(EdgeCsr::toEdge(5, true)));
+    EXPECT_EQ(5u, EdgeCsr::nodeOf(EdgeCsr::toEdge(5, false)));
+    EXPECT_FALSE(EdgeCsr::flagOf(EdgeCsr::toEdge(5, false)));
+    EXPECT_NE(EdgeCsr::toEdge(5, true), EdgeCsr::toEdge(5, false));  // req: diff polarity = diff edge
+}
+
+#define ADD_READ
+// ***********************************************************************************************
+TEST_F(EdgeCsrTest, GOLD_add_thenRead_inOrder)
+{
+    csr_.add(2, EdgeCsr::toEdge(7, true));
+    csr_.add(2, EdgeCsr::toEdge(3, false));
+    csr_.add(0, EdgeCsr::toEdge(2, true));
+
+    EXPECT_EQ(2u, csr_.degree(2));
+    EXPECT_EQ(EdgeCsr::toEdge(7, true), csr_.at(2, 0));   // req: keep add order
+    EXPECT_EQ(EdgeCsr::toEdge(3, false), csr_.at(2, 1));
+    EXPECT_EQ(1u, csr_.degree(0));
+    EXPECT_EQ(0u, csr_.degree(1));                        // req: no edge
+    EXPECT_EQ(0u, csr_.degree(100));                      // req: unknown node
+    EXPECT_EQ(0u, csr_.degree(size_t(-1)));               // req: invalid node
+    EXPECT_EQ(3u, csr_.nEdge());
+
+    EXPECT_TRUE(csr_.has(2, EdgeCsr::toEdge(3, false)));
+    EXPECT_FALSE(csr_.has(2, EdgeCsr::toEdge(3, true)));
+    EXPECT_FALSE(csr_.has(1, EdgeCsr::toEdge(3, false)));
+}
+TEST_F(EdgeCsrTest, GOLD_compact_keepSameView)
+{
+    csr_.add(1, EdgeCsr::toEdge(4, true));
+    csr_.add(3, EdgeCsr::toEdge(5, true));
+    csr_.compact();
+    EXPECT_TRUE(csr_.flat());
+    csr_.add(1, EdgeCsr::toEdge(6, false));  // req: add after compact
+    EXPECT_FALSE(csr_.flat());               // req: in overflow till compact
+
+    EXPECT_EQ(2u, csr_.degree(1));
+    EXPECT_EQ(EdgeCsr::toEdge(4, true), csr_.at(1, 0));
+    EXPECT_EQ(EdgeCsr::toEdge(6, false), csr_.at(1, 1));
+
+    csr_.compact();
+    EXPECT_TRUE(csr_.flat());
+    EXPECT_EQ(2u, csr_.degree(1));           // req: same after compact
+    EXPECT_EQ(EdgeCsr::toEdge(4, true), csr_.at(1, 0));
+    EXPECT_EQ(EdgeCsr::toEdge(6, false), csr_.at(1, 1));
+    EXPECT_EQ(1u, csr_.degree(3));
+    EXPECT_EQ(0u, csr_.degree(2));
+    EXPECT_EQ(3u, csr_.nEdge());
+}
+TEST_F(EdgeCsrTest, autoCompact_whenMuchOverflow)
+{
+    const size_t nEdge = 10 * EdgeCsr::MIN_OVERFLOW;
+    for (size_t node = 0; node < nEdge; ++node) csr_.add(node % 7, EdgeCsr::toEdge(node, node % 2));
+
+    EXPECT_EQ(nEdge, csr_.nEdge());
+    size_t nRead = 0;
+    for (size_t node = 0; node < 7; ++node)
+    {
+        for (size_t idx = 0; idx < csr_.degree(node); ++idx)
+        {
+            EXPECT_EQ(node, EdgeCsr::nodeOf(csr_.at(node, idx)) % 7);  // req: right group
+            ++nRead;
+        }
+    }
+    EXPECT_EQ(nEdge, nRead);
+}
+TEST_F(EdgeCsrTest, compact_byOrder_keepSameView)
+{
+    csr_.add(0, EdgeCsr::toEdge(1, true));
+    csr_.add(2, EdgeCsr::toEdge(3, true));
+    csr_.add(2, EdgeCsr::toEdge(4, false));
+    csr_.compact({2, 0});                    // req: any order, partial ok
+
+    EXPECT_EQ(2u, csr_.degree(2));
+    EXPECT_EQ(EdgeCsr::toEdge(3, true), csr_.at(2, 0));
+    EXPECT_EQ(EdgeCsr::toEdge(4, false), csr_.at(2, 1));
+    EXPECT_EQ(1u, csr_.degree(0));
+    EXPECT_EQ(EdgeCsr::toEdge(1, true), csr_.at(0, 0));
+    EXPECT_EQ(0u, csr_.degree(1));
+    EXPECT_EQ(3u, csr_.nEdge());
+}
+
+#define RM
+// ***********************************************************************************************
+TEST_F(EdgeCsrTest, GOLD_rm_keepOrder_csrAndOverflow)
+{
+    csr_.add(1, EdgeCsr::toEdge(4, true));
+    csr_.add(1, EdgeCsr::toEdge(5, true));
+    csr_.add(1, EdgeCsr::toEdge(6, true));
+    csr_.compact();
+    csr_.add(1, EdgeCsr::toEdge(7, false));
+
+    EXPECT_TRUE(csr_.rm(1, EdgeCsr::toEdge(4, true)));   // req: in CSR
+    EXPECT_TRUE(csr_.rm(1, EdgeCsr::toEdge(7, false)));  // req: in overflow
+    EXPECT_FALSE(csr_.rm(1, EdgeCsr::toEdge(5, false)));
+    EXPECT_FALSE(csr_.rm(2, EdgeCsr::toEdge(5, true)));
+    EXPECT_EQ(2u, csr_.degree(1));
+    EXPECT_EQ(EdgeCsr::toEdge(5, true), csr_.at(1, 0));  // req: rest in order
+    EXPECT_EQ(EdgeCsr::toEdge(6, true), csr_.at(1, 1));
+    EXPECT_EQ(2u, csr_.nEdge());
+
+    csr_.clear(1);
+    EXPECT_EQ(0u, csr_.degree(1));
+    EXPECT_EQ(0u, csr_.nEdge());
+}
+TEST_F(EdgeCsrTest, renumber_dropRemovedNode)
+{
+    csr_.add(0, EdgeCsr::toEdge(3, true));
+    csr_.add(3, EdgeCsr::toEdge(0, false));
+    csr_.add(2, EdgeCsr::toEdge(3, true));
+    csr_.clear(2);
+    csr_.renumber({0, size_t(-1), size_t(-1), 1});  // node 1 & 2 removed
+
+    EXPECT_EQ(EdgeCsr::toEdge(1, true), csr_.at(0, 0));  // req: node renumbered in edge
+    EXPECT_EQ(EdgeCsr::toEdge(0, false), csr_.at(1, 0));
+    EXPECT_EQ(0u, csr_.degree(2));
+    EXPECT_EQ(2u, csr_.nEdge());
+}
+
+#define SNAPSHOT
+// ***********************************************************************************************
+TEST_F(EdgeCsrTest, GOLD_save_load_sameView)
+{
+    const auto path = TempDir() + "EdgeCsrTest.snapshot";
+    csr_.add(0, EdgeCsr::toEdge(2, true));
+    csr_.add(1, EdgeCsr::toEdge(2, false));
+    csr_.add(0, EdgeCsr::toEdge(1, true));
+    DominoSnapshot out;
+    csr_.save(out, DominoSnapshot::tagOf("rang"), DominoSnapshot::tagOf("edge"));
+    ASSERT_TRUE(out.save(path, sizeof(EdgeCsr::Node)));
+
+    DominoSnapshot in;
+    ASSERT_TRUE(in.open(path));
+    EdgeCsr loaded;
+    EXPECT_TRUE(loaded.load(in, DominoSnapshot::tagOf("rang"), DominoSnapshot::tagOf("edge"), 3));
+    EXPECT_EQ(2u, loaded.degree(0));
+    EXPECT_EQ(EdgeCsr::toEdge(1, true), loaded.at(0, 1));
+    EXPECT_EQ(EdgeCsr::toEdge(2, false), loaded.at(1, 0));
+    EXPECT_FALSE(loaded.load(in, DominoSnapshot::tagOf("rang"), DominoSnapshot::tagOf("edge"), 2));  // req: node
+    std::remove(path.c_str());
+}
+TEST_F(EdgeCsrTest, load_badRange_nok)
+{
+    const auto path = TempDir() + "EdgeCsrTest.snapshot";
+    const std::vector<EdgeCsr::Edge> edges{EdgeCsr::toEdge(1, true), EdgeCsr::toEdge(0, true)};
+    for (auto&& ranges : {std::vector<uint64_t>{0, 3, 0, 0},  // beyond edges
+                          std::vector<uint64_t>{1, 0, 0, 0},  // begin > end
+                          std::vector<uint64_t>{0, 2, 1, 2},  // overlap other node's block
+                          std::vector<uint64_t>{0, 1, 1}})    // odd
+    {
+        DominoSnapshot out;
+        out.put(DominoSnapshot::tagOf("rang"), ranges);
+        out.put(DominoSnapshot::tagOf("edge"), edges);
+        ASSERT_TRUE(out.save(path, sizeof(EdgeCsr::Node)));
+        DominoSnapshot in;
+        ASSERT_TRUE(in.open(path));
+        EXPECT_FALSE(csr_.load(in, DominoSnapshot::tagOf("rang"), DominoSnapshot::tagOf("edge"), 2)) << ranges[1];
+    }
+    std::remove(path.c_str());
+}
+
+#define MEM
+// ***********************************************************************************************
+TEST_F(EdgeCsrTest, compact_lessMem)
+{
+    for (size_t node = 0; node < 1000; ++node) csr_.add(node, EdgeCsr::toEdge(node + 1, true));
+    csr_.compact();
+    EXPECT_GE(csr_.nBytes(), 1000 * sizeof(EdgeCsr::Edge));
+    EXPECT_LE(csr_.nBytes(), 1000 * (sizeof(EdgeCsr::Edge) + sizeof(size_t)) * 2);  // req: ~contiguous
+}
+}  // namespace
@@ -1,6 +1,7 @@
 /**
  * Copyright 2019 Nokia. All rights reserved.
  */
+#include <cstdio>  // remove
 #include <gtest/gtest.h>
 #include <memory>
 #include <set>
@@ -126,10 +127,39 @@ TYPED_TEST_P(FreeMultiHdlrDominoTest, BugFix_invalidHdlr_noCrash)
     if (this->msgSelf_->hasMsg()) this->loopbackFunc_() ;
     EXPECT_EQ(std::multiset<int>({4, 5, 6}), this->hdlrIDs_);  // req: re-add ok
 }
+TYPED_TEST_P(FreeHdlrDominoTest, shareTopo_repeatFlag_copyOnWrite)
+{
+    PARA_DOM->flagRepeatedHdlr("e1");
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    EXPECT_TRUE(inst.isRepeatHdlr(inst.getEventBy("e1")));  // req: shared
+
+    inst.flagRepeatedHdlr("e2");  // req: own copy 1st
+    EXPECT_TRUE(inst.isRepeatHdlr(inst.getEventBy("e2")));
+    EXPECT_FALSE(PARA_DOM->isRepeatHdlr(inst.getEventBy("e2")));
+
+    TypeParam viaBase;
+    typename TypeParam::BasicDomino& base = viaBase;
+    base.shareTopo(*PARA_DOM);
+    EXPECT_TRUE(viaBase.isRepeatHdlr(viaBase.getEventBy("e1")));  // req: not lost via base ref
+}
 TYPED_TEST_P(FreeHdlrDominoTest, invalidEv_isRepeatFalse)
 {
     EXPECT_FALSE(PARA_DOM->isRepeatHdlr(Domino::D_EVENT_FAILED_RET));  // ev=0 is invalid ID
 }
+TYPED_TEST_P(FreeHdlrDominoTest, snapshot_keepRepeatFlag)
+{
+    PARA_DOM->flagRepeatedHdlr("e1");
+    PARA_DOM->newEvent("e2");
+    const auto path = TempDir() + "FreeHdlrDominoTest.snapshot";
+    EXPECT_TRUE(PARA_DOM->save(path));
+
+    TypeParam loaded;
+    EXPECT_TRUE(loaded.load(path));
+    EXPECT_TRUE(loaded.isRepeatHdlr(loaded.getEventBy("e1")));  // req: flag restored
+    EXPECT_FALSE(loaded.isRepeatHdlr(loaded.getEventBy("e2")));
+    std::remove(path.c_str());
+}
 
 #define ID_STATE
 // ***********************************************************************************************
@@ -151,6 +181,8 @@ TYPED_TEST_P(FreeHdlrDominoTest, GOLD_nonConstInterface_shall_createUnExistEvent
 REGISTER_TYPED_TEST_SUITE_P(FreeHdlrDominoTest
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
     , invalidEv_isRepeatFalse
+    , shareTopo_repeatFlag_copyOnWrite
+    , snapshot_keepRepeatFlag
 );
 using AnyFreeDom = Types<MinFreeDom, MaxDom>;
 INSTANTIATE_TYPED_TEST_SUITE_P(PARA, FreeHdlrDominoTest, AnyFreeDom);
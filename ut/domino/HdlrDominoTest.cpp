@@ -1,6 +1,7 @@
 /**
  * Copyright 2020 Nokia. All rights reserved.
  */
+#include <cstdio>  // remove
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <set>
@@ -51,6 +52,19 @@ TYPED_TEST_P(HdlrDominoTest, GOLD_addHdlr_ok)
     EXPECT_CALL(*this, hdlr0()).Times(1);      // req: added & called
     PARA_DOM->setState({{"event", true}});
 }
+TYPED_TEST_P(HdlrDominoTest, shareTopo_hdlrPerInstance)
+{
+    PARA_DOM->setPrev("e1", {{"e0", true}});
+    PARA_DOM->setHdlr("e1", this->hdlr0_);
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    inst.setHdlr("e1", this->hdlr1_);
+
+    EXPECT_CALL(*this, hdlr0()).Times(0);  // req: template's hdlr not shared
+    EXPECT_CALL(*this, hdlr1()).Times(1);  // req: inst's own hdlr
+    inst.setState({{"e0", true}});
+    EXPECT_TRUE(inst.sharedTopo());        // req: hdlr is not topology
+}
 TYPED_TEST_P(HdlrDominoTest, dupAdd_nok)
 {
     PARA_DOM->setHdlr("event", this->hdlr0_);
@@ -60,6 +74,29 @@ TYPED_TEST_P(HdlrDominoTest, dupAdd_nok)
     EXPECT_CALL(*this, hdlr1()).Times(0);      // req: fail repeat
     PARA_DOM->setState({{"event", true}});
 }
+TYPED_TEST_P(HdlrDominoTest, addHdlr_byHandle)
+{
+    auto&& hdl = PARA_DOM->newHandle("event");
+    EXPECT_EQ(hdl.event(), PARA_DOM->setHdlr(hdl, this->hdlr0_));
+
+    EXPECT_TRUE(PARA_DOM->rmOneHdlrOK(hdl));   // req: rm by handle
+    EXPECT_EQ(hdl.event(), PARA_DOM->setHdlr(hdl, this->hdlr0_));
+
+    EXPECT_CALL(*this, hdlr0()).Times(1);      // req: added & called
+    PARA_DOM->setState(hdl, true);
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setHdlr(Domino::EventHandle(), this->hdlr1_));
+    EXPECT_FALSE(PARA_DOM->rmOneHdlrOK(Domino::EventHandle()));
+}
+TYPED_TEST_P(HdlrDominoTest, addHdlr_byLiteral)
+{
+    EXPECT_EQ(PARA_DOM->newEvent("event"), PARA_DOM->setHdlr("event"_ev, this->hdlr0_));
+    EXPECT_TRUE(PARA_DOM->rmOneHdlrOK("event"_ev));
+    PARA_DOM->setHdlr("event"_ev, this->hdlr0_);
+
+    EXPECT_CALL(*this, hdlr0()).Times(1);  // req: added & called
+    PARA_DOM->setState("event"_ev, true);
+}
 // ***********************************************************************************************
 // special call hdlr
 // ***********************************************************************************************
@@ -82,6 +119,29 @@ TYPED_TEST_P(NofreeHdlrDominoTest, GOLD_trigger_callback_reTrigger_reCallback)
     EXPECT_CALL(*this, hdlr0()).Times(1);
     PARA_DOM->setState({{"event", true}});     // req: repeat cb
 }
+TYPED_TEST_P(NofreeHdlrDominoTest, retract_thenRetry_reCallback)
+{
+    PARA_DOM->setPrev("done", {{"input", true}});
+    PARA_DOM->setHdlr("done", this->hdlr0_);
+    PARA_DOM->setRetract(true);
+    EXPECT_CALL(*this, hdlr0()).Times(1);
+    PARA_DOM->setState({{"input", true}});
+
+    EXPECT_CALL(*this, hdlr0()).Times(0);   // req: falling no cb
+    PARA_DOM->setState({{"input", false}});
+    EXPECT_CALL(*this, hdlr0()).Times(1);   // req: retry re-cb w/o manual reset of "done"
+    PARA_DOM->setState({{"input", true}});
+}
+TYPED_TEST_P(NofreeHdlrDominoTest, mount_childDone_callParentHdlr)
+{
+    Domino child;
+    child.setPrev("done", {{"step", true}});
+    PARA_DOM->mount("module done", child, "done");
+    PARA_DOM->setHdlr("module done", this->hdlr0_);
+
+    EXPECT_CALL(*this, hdlr0()).Times(1);  // req: parent's hdlr on child's done
+    child.setState({{"step", true}});
+}
 TYPED_TEST_P(NofreeHdlrDominoTest, GOLD_trigger_reTrigger_callback_reCallback)
 {
     // not auto-cb but manually
@@ -291,6 +351,93 @@ TYPED_TEST_P(HdlrDominoTest, rmHdlrOnRoad_noCallback)
     EXPECT_CALL(*this, hdlr1()).Times(1);
     this->loopbackFunc_();                     // manual trigger on road cb
 }
+TYPED_TEST_P(HdlrDominoTest, rmEvent_rmHdlrOnRoad_reuseEv)
+{
+    // not auto-cb but manually
+    auto msgSelf = std::make_shared<MsgSelf>([this](LoopBackFUNC aFunc){ this->loopbackFunc_ = aFunc; });
+    PARA_DOM->setMsgSelf(msgSelf);
+
+    PARA_DOM->setHdlr("session 1", this->hdlr0_);
+    PARA_DOM->setState({{"session 1", true}});                     // cb on road
+    EXPECT_TRUE(PARA_DOM->rmEvent("session 1"));                   // req: rm hdlr include on-road
+    const auto event = PARA_DOM->setHdlr("session 2", this->hdlr1_);  // reuse Event
+
+    EXPECT_CALL(*this, hdlr0()).Times(0);
+    this->loopbackFunc_();
+    EXPECT_CALL(*this, hdlr1()).Times(1);                          // req: reused ev's hdlr kept
+    PARA_DOM->setState({{"session 2", true}});
+    this->loopbackFunc_();
+    EXPECT_EQ(event, PARA_DOM->getEventBy("session 2"));
+}
+TYPED_TEST_P(HdlrDominoTest, compact_keepHdlr)
+{
+    PARA_DOM->newEvent("e1");
+    PARA_DOM->setHdlr("e2", this->hdlr0_);
+    PARA_DOM->rmEvent("e1");
+    EXPECT_TRUE(PARA_DOM->compact());
+
+    EXPECT_CALL(*this, hdlr0()).Times(1);  // req: hdlr follows renumbered ev
+    PARA_DOM->setState({{"e2", true}});
+}
+TYPED_TEST_P(HdlrDominoTest, GOLD_journal_recover_noReRunDoneHdlr)
+{
+    const auto path = TempDir() + "HdlrDominoTest.journal";
+    std::remove(path.c_str());
+    {
+        TypeParam dom;
+        dom.newEvent("e1");
+        dom.newEvent("e2");
+        ASSERT_TRUE(dom.openJournal(path));
+        dom.setHdlr("e1", this->hdlr0_);
+        EXPECT_CALL(*this, hdlr0()).Times(1);
+        dom.setState({{"e1", true}, {"e2", true}});
+        ASSERT_TRUE(dom.commitJournal());
+    }  // crash
+
+    TypeParam restarted;
+    restarted.newEvent("e1");
+    restarted.newEvent("e2");
+    ASSERT_TRUE(restarted.openJournal(path));
+    EXPECT_TRUE(restarted.state("e1"));
+    EXPECT_CALL(*this, hdlr0()).Times(0);
+    restarted.setHdlr("e1", this->hdlr0_);  // req: done before crash, not re-run
+    EXPECT_CALL(*this, hdlr1()).Times(1);
+    restarted.setHdlr("e2", this->hdlr1_);  // req: true but no hdlr done before crash
+
+    EXPECT_CALL(*this, hdlr0()).Times(1);
+    restarted.setState({{"e1", false}});
+    restarted.setState({{"e1", true}});     // req: re-trigger after recovery = re-run
+    std::remove(path.c_str());
+}
+TYPED_TEST_P(HdlrDominoTest, journalAndTrace_1wrapper_freedWithMsgSelf)
+{
+    const auto path = TempDir() + "HdlrDominoTest.journal";
+    std::remove(path.c_str());
+    auto msgSelf = std::make_shared<MsgSelf>([this](LoopBackFUNC aFunc){ this->loopbackFunc_ = aFunc; });
+    TraceRing::start();
+    {
+        TypeParam dom;
+        dom.setMsgSelf(msgSelf);
+        dom.newEvent("e1");
+        ASSERT_TRUE(dom.openJournal(path));
+        dom.setHdlr("e1", this->hdlr0_);
+        dom.setState({{"e1", true}});
+        EXPECT_EQ(1U, msgSelf->nMsg(EMsgPri_NORM));  // req: 1 msg
+        EXPECT_CALL(*this, hdlr0()).Times(1);
+        this->loopbackFunc_();
+
+        dom.setState({{"e1", false}});
+        dom.setState({{"e1", true}});  // on road (if hdlr not freed) when dom destructed
+    }
+    EXPECT_CALL(*this, hdlr0()).Times(0);
+    this->loopbackFunc_();  // req: hdlr expired w/ dom, skipped safely
+    TraceRing::stop();
+
+    size_t nBegin = 0;
+    for (auto&& rec : TraceRing::collect()) nBegin += rec.kind_ == TraceRing::HDLR_BEGIN;
+    EXPECT_EQ(1U, nBegin);  // req: not stacked
+    std::remove(path.c_str());
+}
 TYPED_TEST_P(NofreeHdlrDominoTest, rmHdlrOnRoad_thenReAdd_noCallbackUntilReTrigger)
 {
     // not auto-cb but manually
@@ -352,6 +499,9 @@ TYPED_TEST_P(HdlrDominoTest, GOLD_nonConstInterface_shall_createUnExistEvent_wit
 REGISTER_TYPED_TEST_SUITE_P(HdlrDominoTest
     , GOLD_addHdlr_ok
     , dupAdd_nok
+    , shareTopo_hdlrPerInstance
+    , addHdlr_byHandle
+    , addHdlr_byLiteral
     , GOLD_hdlrInChain_callbackOk
     , hdlrInChain_callAllHdlrs
     , hdlrInChain_dupSatisfy_callbackOnce
@@ -365,6 +515,10 @@ REGISTER_TYPED_TEST_SUITE_P(HdlrDominoTest
     , rmHdlr_thenNoCallback
     , rmHdlr_fail
     , rmHdlrOnRoad_noCallback
+    , rmEvent_rmHdlrOnRoad_reuseEv
+    , compact_keepHdlr
+    , GOLD_journal_recover_noReRunDoneHdlr
+    , journalAndTrace_1wrapper_freedWithMsgSelf
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
 using AnyHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinFreeDom, MinPriDom, MaxNofreeDom, MaxDom>;
@@ -376,6 +530,8 @@ REGISTER_TYPED_TEST_SUITE_P(NofreeHdlrDominoTest
     , multiHdlr_hubTrigger
     , multiHdlr_chainTrigger
     , GOLD_trigger_callback_reTrigger_reCallback
+    , retract_thenRetry_reCallback
+    , mount_childDone_callParentHdlr
     , GOLD_trigger_reTrigger_callback_reCallback
 );
 using AnyNofreeHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinPriDom, MaxNofreeDom>;
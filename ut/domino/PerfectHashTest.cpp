@@ -0,0 +1,44 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+#include <string>
+
+#include "HashedEvName.hpp"
+#include "PerfectHash.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct PerfectHashTest : public Test
+{
+    PerfectHash phash_;
+};
+
+// ***********************************************************************************************
+TEST_F(PerfectHashTest, GOLD_build_thenEachKeyAtOwnIndex)
+{
+    std::vector<size_t> hashes;
+    for (size_t idx = 0; idx < 10'000; ++idx) hashes.push_back(HashedEvName::hashOf("ev" + std::to_string(idx)));
+    ASSERT_TRUE(phash_.build(hashes));
+
+    for (size_t idx = 0; idx < hashes.size(); ++idx) EXPECT_EQ(idx, phash_.at(hashes[idx]));
+    EXPECT_LE(phash_.nBytes(), hashes.size() * (sizeof(size_t) * 2));  // req: compact
+}
+TEST_F(PerfectHashTest, dupHash_nok)
+{
+    EXPECT_FALSE(phash_.build({1, 2, 1}));  // req: can't separate
+    EXPECT_TRUE(phash_.empty());
+    EXPECT_EQ(size_t(PerfectHash::NOT_FOUND), phash_.at(1));
+}
+TEST_F(PerfectHashTest, empty_ok)
+{
+    EXPECT_TRUE(phash_.build({}));
+    EXPECT_EQ(size_t(PerfectHash::NOT_FOUND), phash_.at(123));
+}
+}  // namespace
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // ***********************************************************************************************
+#include <cstdio>  // remove
 #include <gtest/gtest.h>
 #include <memory>
 #include <queue>
@@ -77,6 +78,14 @@ TYPED_TEST_P(PriDominoTest, overwritePriority)
     PARA_DOM->setPriority("event", EMsgPri_NORM);
     EXPECT_EQ(EMsgPri_NORM, PARA_DOM->getPriority(event));
 }
+TYPED_TEST_P(PriDominoTest, setPriority_byHandle)
+{
+    auto&& hdl = PARA_DOM->newHandle("event");
+    EXPECT_EQ(hdl.event(), PARA_DOM->setPriority(hdl, EMsgPri_HIGH));
+    EXPECT_EQ(EMsgPri_HIGH, PARA_DOM->getPriority(hdl.event()));
+
+    EXPECT_EQ(Domino::D_EVENT_FAILED_RET, PARA_DOM->setPriority(Domino::EventHandle(), EMsgPri_HIGH));
+}
 // ***********************************************************************************************
 TYPED_TEST_P(NofreePriDominoTest, GOLD_setPriority_thenPriorityFifoCallback)
 {
@@ -102,6 +111,50 @@ TYPED_TEST_P(NofreePriDominoTest, GOLD_setPriority_thenPriorityFifoCallback)
     EXPECT_EQ(std::queue<int>({5, 4, 2, 1, 3, 4}), this->hdlrIDs_);
 }
 
+TYPED_TEST_P(PriDominoTest, shareTopo_priority_copyOnWrite)
+{
+    PARA_DOM->setPriority("e1", EMsgPri_HIGH);
+    TypeParam inst;
+    inst.shareTopo(*PARA_DOM);
+    EXPECT_EQ(EMsgPri_HIGH, inst.getPriority(inst.getEventBy("e1")));  // req: shared
+
+    inst.setPriority("e1", EMsgPri_LOW);  // req: own copy 1st
+    EXPECT_EQ(EMsgPri_LOW, inst.getPriority(inst.getEventBy("e1")));
+    EXPECT_EQ(EMsgPri_HIGH, PARA_DOM->getPriority(PARA_DOM->getEventBy("e1")));
+
+    TypeParam viaBase;
+    typename TypeParam::BasicDomino& base = viaBase;
+    base.shareTopo(*PARA_DOM);
+    EXPECT_EQ(EMsgPri_HIGH, viaBase.getPriority(viaBase.getEventBy("e1")));  // req: not lost via base ref
+}
+TYPED_TEST_P(PriDominoTest, rmEvent_rmPriority_compactKeep)
+{
+    PARA_DOM->setPriority("session 1", EMsgPri_HIGH);
+    PARA_DOM->setPriority("e2", EMsgPri_LOW);
+    EXPECT_TRUE(PARA_DOM->rmEvent("session 1"));
+    EXPECT_EQ(EMsgPri_NORM, PARA_DOM->getPriority(PARA_DOM->newEvent("session 2")));  // req: reused ev w/o old pri
+
+    PARA_DOM->rmEvent("session 2");
+    EXPECT_TRUE(PARA_DOM->compact());
+    EXPECT_EQ(0u, PARA_DOM->getEventBy("e2"));
+    EXPECT_EQ(EMsgPri_LOW, PARA_DOM->getPriority(PARA_DOM->getEventBy("e2")));  // req: pri follows renumbered ev
+}
+TYPED_TEST_P(PriDominoTest, snapshot_keepPriority)
+{
+    PARA_DOM->setPriority("e1", EMsgPri_HIGH);
+    PARA_DOM->setPriority("e3", EMsgPri_LOW);
+    PARA_DOM->newEvent("e2");
+    const auto path = TempDir() + "PriDominoTest.snapshot";
+    EXPECT_TRUE(PARA_DOM->save(path));
+
+    TypeParam loaded;
+    EXPECT_TRUE(loaded.load(path));
+    EXPECT_EQ(EMsgPri_HIGH, loaded.getPriority(loaded.getEventBy("e1")));  // req: pri restored
+    EXPECT_EQ(EMsgPri_NORM, loaded.getPriority(loaded.getEventBy("e2")));
+    EXPECT_EQ(EMsgPri_LOW,  loaded.getPriority(loaded.getEventBy("e3")));
+    std::remove(path.c_str());
+}
+
 #define ID_STATE
 // ***********************************************************************************************
 // event & EvName are ID
@@ -123,6 +176,10 @@ REGISTER_TYPED_TEST_SUITE_P(PriDominoTest
     , setPriority_thenGetIt
     , defaultPriority
     , overwritePriority
+    , setPriority_byHandle
+    , shareTopo_priority_copyOnWrite
+    , rmEvent_rmPriority_compactKeep
+    , snapshot_keepPriority
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
 using AnyPriDom = Types<MinPriDom, MaxNofreeDom, MaxDom>;
@@ -0,0 +1,144 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "DominoWorkload.hpp"
+#include "SlicedDomino.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct SlicedDominoTest : public Test
+{
+    Domino topo_;
+};
+
+#define SAME_AS_DOMINO
+// ***********************************************************************************************
+TEST_F(SlicedDominoTest, GOLD_sameAs_nDomino)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = 300;
+    const auto wl = genWorkload(cfg);
+    loadWorkload(topo_, wl);
+
+    const size_t nInst = 70;  // req: multi words & partial last word
+    SlicedDomino sliced(topo_, nInst);
+    std::vector<std::unique_ptr<Domino> > doms;
+    for (size_t inst = 0; inst < nInst; ++inst)
+    {
+        doms.emplace_back(new Domino);
+        loadWorkload(*doms.back(), wl);
+    }
+
+    for (size_t step = 0; step < wl.nStep(); ++step)  // inst progresses to its own step
+    {
+        SlicedDomino::InstEvents instEvents;
+        const auto& stimulus = wl.stimuli[wl.stepBegins[step]];
+        const auto evName = DominoWorkload::evName(stimulus.event);
+        for (size_t inst = 0; inst < nInst; ++inst)
+        {
+            if (step >= inst * wl.nStep() / nInst) continue;
+            doms[inst]->setState(evName, stimulus.state);
+            instEvents.push_back({inst, evName, stimulus.state});
+        }
+        sliced.setState(instEvents);  // req: all inst in 1 pass
+    }
+
+    for (size_t ev = 0; ev < wl.nEvent; ++ev)
+    {
+        const auto evName = DominoWorkload::evName(ev);
+        size_t nTrue = 0;
+        for (size_t inst = 0; inst < nInst; ++inst)
+        {
+            EXPECT_EQ(doms[inst]->state(evName), sliced.state(inst, evName)) << "inst=" << inst << ", ev=" << ev;
+            nTrue += doms[inst]->state(evName);
+        }
+        EXPECT_EQ(nTrue, sliced.nTrue(evName));
+    }
+}
+TEST_F(SlicedDominoTest, GOLD_setState_byInsts)
+{
+    topo_.setPrev("e2", {{"e1", true}, {"e0", false}});
+    topo_.setPrev("e3", {{"e2", true}});
+    SlicedDomino sliced(topo_, 100);
+
+    auto insts = sliced.noInsts();
+    SlicedDomino::addInst(insts, 0);
+    SlicedDomino::addInst(insts, 70);
+    sliced.setState(insts, {{"e1", true}});
+    EXPECT_TRUE(sliced.state(0, "e3"));   // req: deduced for selected inst
+    EXPECT_TRUE(sliced.state(70, "e3"));
+    EXPECT_FALSE(sliced.state(1, "e3"));  // req: not for others
+    EXPECT_EQ(2u, sliced.nTrue("e3"));
+
+    sliced.setState(sliced.allInsts(), {{"e0", true}});
+    sliced.setState(sliced.allInsts(), {{"e1", true}});
+    EXPECT_EQ(2u, sliced.nTrue("e2"));  // req: false prev respected
+    EXPECT_EQ(100u, sliced.nTrue("e1"));
+}
+TEST_F(SlicedDominoTest, initState_fromTopo)
+{
+    topo_.setPrev("e1", {{"e0", false}});  // e1 deduced true at once
+    topo_.setState({{"e5", true}});
+    SlicedDomino sliced(topo_, 65);
+
+    EXPECT_EQ(65u, sliced.nTrue("e1"));  // req: all inst start as topo
+    EXPECT_EQ(65u, sliced.nTrue("e5"));
+    EXPECT_EQ(0u, sliced.nTrue("e0"));
+}
+TEST_F(SlicedDominoTest, kOfN_sameAs_domino)
+{
+    topo_.setPrev("or", {{"a", true}, {"b", false}});
+    topo_.setNeed("or", 1);
+    topo_.setPrev("2of3", {{"a", true}, {"c", true}, {"d", true}});
+    topo_.setNeed("2of3", 2);
+    SlicedDomino sliced(topo_, 70);
+    EXPECT_EQ(70u, sliced.nTrue("or"));  // req: b==false satisfied at start
+
+    sliced.setState(3, {{"a", true}});
+    sliced.setState(69, {{"c", true}});
+    sliced.setState(69, {{"d", true}});
+    sliced.setState(5, {{"c", true}});
+    EXPECT_TRUE(sliced.state(69, "2of3"));  // req: k reached per instance
+    EXPECT_FALSE(sliced.state(3, "2of3"));
+    EXPECT_FALSE(sliced.state(5, "2of3"));
+    sliced.setState(3, {{"d", true}});
+    EXPECT_TRUE(sliced.state(3, "2of3"));
+    EXPECT_EQ(2u, sliced.nTrue("2of3"));
+}
+TEST_F(SlicedDominoTest, narrowEvent)
+{
+    Domino16 topo;
+    topo.setPrev("e1", {{"e0", true}});
+    BasicSlicedDomino<uint16_t> sliced(topo, 3);
+
+    sliced.setState(2, {{"e0", true}});
+    EXPECT_EQ(1u, sliced.nTrue("e1"));
+    EXPECT_TRUE(sliced.state(2, "e1"));
+}
+
+#define INVALID
+// ***********************************************************************************************
+TEST_F(SlicedDominoTest, invalid_noChange)
+{
+    topo_.setPrev("e1", {{"e0", true}});
+    SlicedDomino sliced(topo_, 10);
+
+    sliced.setState(10, {{"e0", true}});        // invalid inst
+    sliced.setState(0, {{"unknown", true}});    // unknown ev
+    sliced.setState(SlicedDomino::Insts(5), {{"e0", true}});  // wrong size
+    sliced.setState({{20, "e0", true}});
+    EXPECT_EQ(0u, sliced.nTrue("e0"));
+    EXPECT_EQ(0u, sliced.nTrue("e1"));
+    EXPECT_FALSE(sliced.state(0, "unknown"));
+    EXPECT_FALSE(sliced.state(10, "e0"));
+}
+}  // namespace
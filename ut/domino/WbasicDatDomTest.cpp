@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 // ***********************************************************************************************
+#include <cstdio>  // remove
 #include <gtest/gtest.h>
 #include <memory>  // make_shared
 #include <set>
@@ -61,6 +62,29 @@ TYPED_TEST_P(WbasicDatDomTest, GOLD_write_ctrl)
     valGet = getValue<TypeParam, size_t>(*PARA_DOM, "ev0");
     EXPECT_NE(3u, valGet);                             // req: legacy get failed
 }
+TYPED_TEST_P(WbasicDatDomTest, write_ctrl_byHandle)
+{
+    auto&& hdl = PARA_DOM->newHandle("ev0");
+    PARA_DOM->wrCtrlOk(hdl);
+    EXPECT_TRUE(PARA_DOM->isWrCtrl("ev0"));            // req: same as EvName
+
+    wbasic_setValue<TypeParam, size_t>(*PARA_DOM, hdl, 1);
+    EXPECT_EQ(1u, (wbasic_getValue<TypeParam, size_t>(*PARA_DOM, hdl)));
+
+    setValue<TypeParam, size_t>(*PARA_DOM, hdl, 2);    // legacy set
+    EXPECT_EQ(1u, (wbasic_getValue<TypeParam, size_t>(*PARA_DOM, "ev0")));  // req: legacy set failed
+}
+TYPED_TEST_P(WbasicDatDomTest, write_ctrl_byLiteral)
+{
+    PARA_DOM->wrCtrlOk("ev0"_ev);
+    EXPECT_TRUE(PARA_DOM->isWrCtrl("ev0"_ev));
+
+    wbasic_setValue<TypeParam, size_t>(*PARA_DOM, "ev0"_ev, 1);
+    EXPECT_EQ(1u, (wbasic_getValue<TypeParam, size_t>(*PARA_DOM, "ev0"_ev)));
+
+    setValue<TypeParam, size_t>(*PARA_DOM, "ev0"_ev, 2);  // legacy set
+    EXPECT_EQ(1u, (wbasic_getValue<TypeParam, size_t>(*PARA_DOM, "ev0")));  // req: legacy set failed
+}
 TYPED_TEST_P(WbasicDatDomTest, GOLD_no_write_ctrl)
 {
     setValue<TypeParam, size_t>(*PARA_DOM, "ev0", 1);
@@ -95,6 +119,19 @@ TYPED_TEST_P(WbasicDatDomTest, canNOT_setWriteCtrl_sinceOutCtrl)
     EXPECT_TRUE(PARA_DOM->wrCtrlOk("ev0"));   // req: can
     EXPECT_TRUE(PARA_DOM->isWrCtrl("ev0"));   // req: can
 }
+TYPED_TEST_P(WbasicDatDomTest, snapshot_keepWrCtrl)
+{
+    PARA_DOM->wrCtrlOk("e1");
+    PARA_DOM->newEvent("e2");
+    const auto path = TempDir() + "WbasicDatDomTest.snapshot";
+    EXPECT_TRUE(PARA_DOM->save(path));
+
+    TypeParam loaded;
+    EXPECT_TRUE(loaded.load(path));
+    EXPECT_TRUE(loaded.isWrCtrl("e1"));  // req: flag restored, data not (it's ptr)
+    EXPECT_FALSE(loaded.isWrCtrl("e2"));
+    std::remove(path.c_str());
+}
 
 #define ID_STATE
 // ***********************************************************************************************
@@ -136,8 +173,11 @@ TYPED_TEST_P(WbasicDatDomTest, GOLD_nonConstInterface_shall_createUnExistEvent_w
 REGISTER_TYPED_TEST_SUITE_P(WbasicDatDomTest
     , GOLD_setFlag_thenGetIt
     , GOLD_write_ctrl
+    , write_ctrl_byHandle
+    , write_ctrl_byLiteral
     , GOLD_no_write_ctrl
     , canNOT_setWriteCtrl_sinceOutCtrl
+    , snapshot_keepWrCtrl
     , GOLD_nonConstInterface_shall_createUnExistEvent_withStateFalse
 );
 using AnyDatDom = Types<MinWbasicDatDom, MaxNofreeDom, MaxDom>;
@@ -0,0 +1,190 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "DominoWorkload.hpp"
+#include "UtInitObjAnywhere.hpp"
+#include "WhatIf.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct WhatIfTest : public Test
+{
+    // record fired order of a real Domino via effect()
+    struct RecDom : public Domino
+    {
+        std::vector<EvName> fired_;
+        void effect(const Event aEv) override { fired_.emplace_back(evName(aEv)); }
+    };
+    static std::vector<Domino::EvName> toNames(const WhatIf::EvNameViews& aViews)
+    {
+        return std::vector<Domino::EvName>(aViews.begin(), aViews.end());
+    }
+
+    Domino base_;
+};
+
+#define SAME_AS_DOMINO
+// ***********************************************************************************************
+TEST_F(WhatIfTest, GOLD_sameAs_realSetState_baseUnchanged)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = 300;
+    cfg.falsePct = 10;
+    const auto wl = genWorkload(cfg);
+    loadWorkload(base_, wl);
+    replayStep(base_, wl, 0);
+    base_.freeze();
+
+    for (size_t step = 1; step < wl.nStep(); ++step)
+    {
+        RecDom real;
+        loadWorkload(real, wl);
+        replayStep(real, wl, 0);
+        real.freeze();
+        real.fired_.clear();
+
+        WhatIf whatIf(base_);
+        Domino::SimuEvents simu;
+        const auto end = step + 1 < wl.nStep() ? wl.stepBegins[step + 1] : wl.stimuli.size();
+        for (auto idx = wl.stepBegins[step]; idx < end; ++idx)
+            simu[DominoWorkload::evName(wl.stimuli[idx].event)] = wl.stimuli[idx].state;
+        real.setState(simu);
+        EXPECT_TRUE(whatIf.setState(simu));
+
+        EXPECT_EQ(real.fired_, toNames(whatIf.fired())) << "step=" << step;  // req: same fired & order
+        const auto delta = whatIf.delta();
+        for (size_t ev = 0; ev < wl.nEvent; ++ev)
+        {
+            const auto evName = DominoWorkload::evName(ev);
+            EXPECT_EQ(real.state(evName), whatIf.state(evName)) << "step=" << step << ", ev=" << ev;
+            EXPECT_EQ(real.state(evName) != base_.state(evName), delta.count(evName) > 0);
+        }
+    }
+    RecDom real;
+    loadWorkload(real, wl);
+    replayStep(real, wl, 0);
+    for (size_t ev = 0; ev < wl.nEvent; ++ev)  // req: base not changed by any overlay
+        EXPECT_EQ(real.state(DominoWorkload::evName(ev)), base_.state(DominoWorkload::evName(ev)));
+}
+TEST_F(WhatIfTest, GOLD_delta_fired)
+{
+    base_.setPrev("e2", {{"e1", true}, {"e0", false}});
+    base_.setPrev("e3", {{"e2", true}});
+    base_.setState({{"e5", true}});
+
+    WhatIf whatIf(base_);
+    whatIf.setState({{"e1", true}, {"e5", false}});
+    EXPECT_EQ(Domino::SimuEvents({{"e1", true}, {"e2", true}, {"e3", true}, {"e5", false}}), whatIf.delta());
+    EXPECT_EQ(std::vector<Domino::EvName>({"e1", "e2", "e3"}), toNames(whatIf.fired()));  // req: F->T only
+    EXPECT_FALSE(base_.state("e3"));  // req: base untouched
+    EXPECT_TRUE(base_.state("e5"));
+
+    whatIf.setState({{"e0", true}});  // req: accumulate
+    EXPECT_TRUE(whatIf.state("e3"));  // no T->F cascade, same as Domino
+    EXPECT_TRUE(whatIf.state("e0"));
+
+    whatIf.reset();
+    EXPECT_TRUE(whatIf.delta().empty());
+    EXPECT_TRUE(whatIf.fired().empty());
+    EXPECT_FALSE(whatIf.state("e3"));
+}
+TEST_F(WhatIfTest, kOfN_tile)
+{
+    base_.setPrev("2of3", {{"a", true}, {"b", true}, {"c", true}});
+    base_.setNeed("2of3", 2);
+    base_.setState({{"a", true}});
+
+    WhatIf whatIf(base_);
+    whatIf.setState({{"c", true}});
+    EXPECT_TRUE(whatIf.state("2of3"));  // req: same counter rule as Domino
+    EXPECT_FALSE(base_.state("2of3"));
+}
+TEST_F(WhatIfTest, parallel_onFrozenBase)
+{
+    WorkloadCfg cfg;
+    cfg.nEvent = 2000;
+    const auto wl = genWorkload(cfg);
+    loadWorkload(base_, wl);
+    base_.freeze();
+
+    const size_t nThread = 4;
+    std::vector<Domino::SimuEvents> expected(nThread);
+    for (size_t idx = 0; idx < nThread; ++idx)  // sequential 1st
+    {
+        WhatIf whatIf(base_);
+        whatIf.setState({{DominoWorkload::evName(wl.stimuli[idx].event), true}});
+        expected[idx] = whatIf.delta();
+    }
+
+    std::vector<Domino::SimuEvents> actual(nThread);
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < nThread; ++idx)
+    {
+        threads.emplace_back([&, idx]
+        {
+            WhatIf whatIf(base_);
+            whatIf.setState({{DominoWorkload::evName(wl.stimuli[idx].event), true}});
+            actual[idx] = whatIf.delta();
+        });
+    }
+    for (auto&& thread : threads) thread.join();
+    EXPECT_EQ(expected, actual);  // req: same result in parallel
+}
+
+#define INVALID
+// ***********************************************************************************************
+TEST_F(WhatIfTest, unknownEvName_skipped)
+{
+    base_.setPrev("e1", {{"e0", true}});
+    WhatIf whatIf(base_);
+
+    EXPECT_FALSE(whatIf.setState({{"unknown", true}, {"e0", true}}));
+    EXPECT_TRUE(whatIf.state("e1"));  // req: known still evaluated
+    EXPECT_FALSE(whatIf.state("unknown"));
+    EXPECT_EQ(2u, whatIf.delta().size());
+    EXPECT_EQ(2u, base_.nEvent());  // req: no new event in base
+}
+
+#define HDLR
+// ***********************************************************************************************
+template<class aParaDom>
+struct WhatIfHdlrTest : public Test
+{
+    UtInitObjAnywhere utInit_;
+    size_t nCall_ = 0;
+};
+TYPED_TEST_SUITE_P(WhatIfHdlrTest);
+
+TYPED_TEST_P(WhatIfHdlrTest, GOLD_hdlrs_notCalled)
+{
+    PARA_DOM->setPrev("e2", {{"e1", true}});
+    PARA_DOM->setPrev("e3", {{"e2", true}});
+    PARA_DOM->setHdlr("e1", [this]{ ++this->nCall_; });
+    PARA_DOM->setHdlr("e3", [this]{ ++this->nCall_; });
+
+    BasicWhatIf<typename TypeParam::Event> whatIf(*PARA_DOM);
+    whatIf.setState({{"e1", true}});
+    EXPECT_EQ(std::vector<std::string_view>({"e1", "e3"}), whatIf.hdlrs());  // req: which hdlr would run
+    EXPECT_EQ(3u, whatIf.fired().size());
+    EXPECT_EQ(0u, this->nCall_);                                        // req: no hdlr run
+    EXPECT_FALSE(ObjAnywhere::get<MsgSelf>()->hasMsg());                // req: nothing into MsgSelf
+    EXPECT_FALSE(PARA_DOM->state("e3"));
+
+    PARA_DOM->setState({{"e1", true}});  // real one as predicted
+    EXPECT_EQ(2u, this->nCall_);
+}
+REGISTER_TYPED_TEST_SUITE_P(WhatIfHdlrTest
+    , GOLD_hdlrs_notCalled
+);
+using AnyHdlrDom = Types<MinHdlrDom, MinMhdlrDom, MinPriDom, MaxNofreeDom, MaxDom>;
+INSTANTIATE_TYPED_TEST_SUITE_P(PARA, WhatIfHdlrTest, AnyHdlrDom);
+}  // namespace
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "WorkerPool.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+TEST(WorkerPoolTest, GOLD_run_eachThrdOnce_perRound)
+{
+    WorkerPool pool(3);
+    EXPECT_EQ(3u, pool.nWorker());
+    for (size_t round = 0; round < 1000; ++round)  // req: reuse same workers
+    {
+        std::vector<size_t> nRun(4, 0);  // each index by 1 thread only, no lock needed
+        pool.run([&nRun](const size_t aThrd) { ++nRun[aThrd]; }, 4);
+        EXPECT_EQ(std::vector<size_t>(4, 1), nRun);  // req: all done when run() returns
+    }
+}
+TEST(WorkerPoolTest, run_lessThrd_orMore)
+{
+    WorkerPool pool(3);
+    std::atomic<size_t> nRun(0);
+    std::thread::id idOf0;
+    pool.run([&](const size_t aThrd) { ++nRun; if (aThrd == 0) idOf0 = std::this_thread::get_id(); }, 2);
+    EXPECT_EQ(2u, nRun);                              // req: only aNThrd
+    EXPECT_EQ(std::this_thread::get_id(), idOf0);     // req: 0 on caller
+
+    nRun = 0;
+    pool.run([&nRun](const size_t) { ++nRun; }, 10);
+    EXPECT_EQ(4u, nRun);  // req: capped by nWorker + caller
+
+    WorkerPool none(0);
+    nRun = 0;
+    none.run([&nRun](const size_t) { ++nRun; }, 4);
+    EXPECT_EQ(1u, nRun);  // req: caller only
+}
+}  // namespace
@@ -133,6 +133,28 @@ TEST_F(MsgSelfTests, newHighPri_first)
     EXPECT_EQ(std::queue<int>({5, 4, 2, 1, 3}), hdlrIDs_);
 }
 
+#define OWN_MSG
+// ***********************************************************************************************
+TEST_F(MsgSelfTests, GOLD_ownMsg_freedAfterCall_orDiscard)
+{
+    auto owned = std::make_shared<MsgCB>([this](){ hdlrIDs_.push(1); });
+    WeakMsgCB weak = owned;
+    msgSelf_->ownMsg(owned);
+    owned.reset();
+    EXPECT_FALSE(weak.expired());  // req: kept by MsgSelf
+    loopbackFunc_();
+    EXPECT_EQ(std::queue<int>({1}), hdlrIDs_);
+    EXPECT_TRUE(weak.expired());   // req: freed after call
+
+    owned = std::make_shared<MsgCB>([this](){ hdlrIDs_.push(2); });
+    weak = owned;
+    msgSelf_->ownMsg(owned, EMsgPri_LOW);
+    owned.reset();
+    msgSelf_.reset();              // never called
+    EXPECT_TRUE(weak.expired());   // req: no leak
+    EXPECT_EQ(std::queue<int>({1}), hdlrIDs_);
+}
+
 #define INVALID_MSGSELF
 // ***********************************************************************************************
 TEST_F(MsgSelfTests, invalidMsgSelf_callbackShallNotCrash)
@@ -0,0 +1,118 @@
+/**
+ * Copyright 2026 Nokia
+ * Licensed under the BSD 3 Clause license
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+// ***********************************************************************************************
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "MsgSelf.hpp"
+#include "TraceRing.hpp"
+
+using namespace testing;
+
+namespace RLib
+{
+// ***********************************************************************************************
+struct TraceRingTest : public Test
+{
+    ~TraceRingTest()
+    {
+        TraceRing::stop();
+        TraceRing::start();  // default max thread for others
+        TraceRing::stop();
+    }
+
+    static std::vector<uint64_t> idsOf(const TraceRing::Records& aRecords)
+    {
+        std::vector<uint64_t> ids;
+        for (auto&& rec : aRecords) ids.push_back(rec.id_);
+        return ids;
+    }
+};
+
+// ***********************************************************************************************
+TEST_F(TraceRingTest, GOLD_record_collect_inOrder)
+{
+    TraceRing::start();
+    EXPECT_TRUE(TraceRing::on());
+    TraceRing::record(TraceRing::STATE_TRUE, 3, 7);
+    TraceRing::record(TraceRing::EFFECT, 3, 7);
+    TraceRing::stop();
+    TraceRing::record(TraceRing::STATE_FALSE, 4, 7);  // req: off = not recorded
+
+    const auto records = TraceRing::collect();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(TraceRing::STATE_TRUE, records[0].kind_);
+    EXPECT_EQ(TraceRing::EFFECT, records[1].kind_);
+    EXPECT_EQ(7u, records[1].src_);
+    EXPECT_LE(records[0].tsc_, records[1].tsc_);
+
+    TraceRing::start();
+    EXPECT_TRUE(TraceRing::collect().empty());  // req: start() drops old
+}
+TEST_F(TraceRingTest, full_keepLatest)
+{
+    TraceRing::start(3);  // -> 4
+    for (uint64_t id = 0; id < 10; ++id) TraceRing::record(TraceRing::EFFECT, id, 0);
+    TraceRing::stop();
+
+    EXPECT_EQ(std::vector<uint64_t>({6, 7, 8, 9}), idsOf(TraceRing::collect()));  // req: oldest overwritten
+    EXPECT_EQ(6u, TraceRing::nDropped());
+}
+TEST_F(TraceRingTest, perThread_mergedByTsc)
+{
+    TraceRing::start();
+    TraceRing::record(TraceRing::EFFECT, 1, 0);
+    std::thread([] { TraceRing::record(TraceRing::EFFECT, 2, 0); }).join();  // req: ring kept after thread exit
+    TraceRing::record(TraceRing::EFFECT, 3, 0);
+    TraceRing::stop();
+
+    const auto records = TraceRing::collect();
+    EXPECT_EQ(std::vector<uint64_t>({1, 2, 3}), idsOf(records));
+    ASSERT_EQ(3u, records.size());
+    EXPECT_NE(records[0].thread_, records[1].thread_);
+    EXPECT_EQ(records[0].thread_, records[2].thread_);
+}
+TEST_F(TraceRingTest, exitedRing_reusedAfterCollect_maxThread)
+{
+    TraceRing::start(16, 2);  // caller's + 1 (other tests' exited rings freed by start(), so reusable)
+    auto&& recordInThread = [](const uint64_t aId)
+    {
+        std::thread([aId] { TraceRing::record(TraceRing::EFFECT, aId, 0); }).join();
+    };
+    recordInThread(1);
+    recordInThread(2);  // req: exited ring not reused before its records collected, so no ring
+    EXPECT_EQ(1u, TraceRing::nDropped());
+
+    auto records = TraceRing::collect();
+    EXPECT_EQ(std::vector<uint64_t>({1}), idsOf(records));
+    const auto thread1 = records[0].thread_;
+    TraceRing::start(16, 2);  // req: refused thread can retry after start()
+    recordInThread(3);        // req: reuse
+    TraceRing::stop();
+    records = TraceRing::collect();
+    ASSERT_EQ(std::vector<uint64_t>({3}), idsOf(records));
+    EXPECT_EQ(thread1, records[0].thread_);
+    EXPECT_EQ(0u, TraceRing::nDropped());
+}
+TEST_F(TraceRingTest, msgSelf_dispatch)
+{
+    LoopBackFUNC loopback;
+    MsgSelf msgSelf([&loopback](LoopBackFUNC aFunc) { loopback = aFunc; });
+    auto&& hdlr = std::make_shared<MsgCB>([] { TraceRing::record(TraceRing::EFFECT, 9, 0); });
+    msgSelf.newMsg(hdlr, EMsgPri_HIGH);
+
+    TraceRing::start();
+    loopback();
+    TraceRing::stop();
+    const auto records = TraceRing::collect();
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(TraceRing::MSG_BEGIN, records[0].kind_);  // req: hdlr run between
+    EXPECT_EQ(EMsgPri_HIGH, records[0].id_);
+    EXPECT_EQ(TraceRing::NO_SRC, records[0].src_);
+    EXPECT_EQ(TraceRing::EFFECT, records[1].kind_);
+    EXPECT_EQ(TraceRing::MSG_END, records[2].kind_);
+}
+}  // namespace